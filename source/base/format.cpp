@@ -15,6 +15,7 @@
 #include "base/time.h"
 #include "base/format.h"
 #include <regex>
+#include <cstdio>
 
 /***** FUNCTIONS *******************************/
 
@@ -43,16 +44,17 @@ std::string operator%(LongDouble value, const std::string &format)
         throw(Exception("expecting qualifier after '%'"));
 
       // parse %[flags][width][.precision]specifier format
-      std::stringstream ss;
       auto c = format.at(posFormat++);
 
       Bool hasSubSpecifiers = FALSE;
+      Bool isZeroFill = FALSE, isLeft = FALSE;
+      Int  width = 0, precision = 6;
       // [flags]
       for(;;)
       {
-        if(c=='0')      ss.fill('0');
-        else if(c==' ') ss.fill(' ');
-        else if(c=='-') ss.setf(std::ios_base::left, std::ios_base::adjustfield);
+        if(c=='0')      isZeroFill = TRUE;
+        else if(c==' ') isZeroFill = FALSE;
+        else if(c=='-') isLeft = TRUE;
         else if(c=='#') throw(Exception("'#' not supported"));
         else if(c=='+') throw(Exception("'+' not supported"));
         else break;
@@ -65,7 +67,7 @@ std::string operator%(LongDouble value, const std::string &format)
       {
         const char *ptr1 = format.c_str()+posFormat-1;
         char *ptr2;
-        ss.width(std::strtol(ptr1, &ptr2, 10));
+        width = static_cast<Int>(std::strtol(ptr1, &ptr2, 10));
         posFormat += ptr2-ptr1-1;
         c = format.at(posFormat++);
         hasSubSpecifiers = TRUE;
@@ -76,12 +78,37 @@ std::string operator%(LongDouble value, const std::string &format)
       {
         const char *ptr1 = format.c_str()+posFormat;
         char *ptr2;
-        ss.precision(std::strtol(ptr1, &ptr2, 10));
+        precision = static_cast<Int>(std::strtol(ptr1, &ptr2, 10));
         posFormat += ptr2-ptr1;
         c = format.at(posFormat++);
         hasSubSpecifiers = TRUE;
       }
 
+      // numbers are formatted directly without stream
+      // (the stream pads zeros before the sign or after the number)
+      if(((c=='i') || (c=='f') || (c=='e') || (c=='g')) && (!isZeroFill || (!isLeft && std::isfinite(value) && !std::signbit(value))))
+      {
+        const UInt flag = (isLeft) ? 0 : (isZeroFill) ? 1 : 2;
+        const char *formatsInt[]      = {"%-*d", "%0*d", "%*d"};
+        const char *formatsDouble[][3] = {{"%-*.*Lf", "%0*.*Lf", "%*.*Lf"}, {"%-*.*Le", "%0*.*Le", "%*.*Le"}, {"%-*.*Lg", "%0*.*Lg", "%*.*Lg"}};
+        char buffer[64];
+        const Int size = (c=='i') ? std::snprintf(buffer, sizeof(buffer), formatsInt[flag], width, static_cast<int>(std::round(value)))
+                                  : std::snprintf(buffer, sizeof(buffer), formatsDouble[(c=='f') ? 0 : (c=='e') ? 1 : 2][flag], width, precision, value);
+        if((size >= 0) && (size < static_cast<Int>(sizeof(buffer))))
+        {
+          result.append(buffer, size);
+          continue;
+        }
+      }
+
+      std::stringstream ss;
+      if(isZeroFill)
+        ss.fill('0');
+      if(isLeft)
+        ss.setf(std::ios_base::left, std::ios_base::adjustfield);
+      ss.width(width);
+      ss.precision(precision);
+
       // specifier
       switch(c)
       {
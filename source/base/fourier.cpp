@@ -231,6 +231,63 @@ Vector Fourier::synthesis(const std::vector<std::complex<Double>> &F, Bool count
 
 /***********************************************/
 
+void Fourier::filter(MatrixSliceRef data, const std::vector<std::complex<Double>> &H)
+{
+  try
+  {
+    const UInt count = data.rows();
+    if(!count)
+      return;
+    if(H.size() != (count+2)/2)
+      throw(Exception("size of transfer function ("+H.size()%"%i"s+") does not match data length ("+count%"%i"s+")"));
+
+    // compute twiddle factors once for all columns
+    std::vector<std::complex<Double>> twiddles(count), twiddlesInverse(count);
+    for(UInt i=0; i<twiddles.size(); i++)
+    {
+      twiddles[i]        = std::exp(std::complex<Double>(0, -2*PI*i/count));
+      twiddlesInverse[i] = std::conj(twiddles[i]);
+    }
+    std::vector<UInt> factors = computeRadix(count);
+
+    // transfer function at all spectral lines of a real filter
+    // (only real part at zero and Nyquist frequency as in synthesis)
+    std::vector<std::complex<Double>> H2(count);
+    for(UInt i=1; i<H.size(); i++)
+    {
+      H2[i]       = H[i];
+      H2[count-i] = std::conj(H[i]);
+    }
+    H2[0] = H[0].real();
+    if(count%2 == 0)
+      H2[count/2] = H[count/2].real();
+
+    // two real columns as real and imaginary part of one complex sequence
+    std::vector<std::complex<Double>> f(count), F(count);
+    for(UInt k=0; k<data.columns(); k+=2)
+    {
+      const Bool isPair = (k+1 < data.columns());
+      for(UInt i=0; i<count; i++)
+        f[i] = std::complex<Double>(data(i, k), (isPair ? data(i, k+1) : 0.));
+      recursiveFft(FALSE/*inverse*/, F.data(), f.data(), factors.data(), twiddles, 1);
+      for(UInt i=0; i<count; i++)
+        F[i] *= H2[i];
+      recursiveFft(TRUE/*inverse*/, f.data(), F.data(), factors.data(), twiddlesInverse, 1);
+      for(UInt i=0; i<count; i++)
+        data(i, k) = (1./count)*f[i].real();
+      if(isPair)
+        for(UInt i=0; i<count; i++)
+          data(i, k+1) = (1./count)*f[i].imag();
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Vector Fourier::frequencies(UInt count, Double dt)
 {
   Vector frequencies((count+2)/2);
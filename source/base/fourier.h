@@ -50,6 +50,14 @@ namespace Fourier
   * @return data series */
   Vector synthesis(const std::vector<std::complex<Double>> &F, Bool countEven);
 
+  /** @brief Filter all columns of @a data with a transfer function.
+  * Equivalent to a call of fft, a multiplication with @a H, and synthesis for each column.
+  * Two columns are transformed together in one complex FFT and the twiddle factors
+  * are computed only once for all columns.
+  * @param[in,out] data data series (columns)
+  * @param H transfer function at the @f$[n/2]+1@f$ spectral lines (e.g. frequency response of a digital filter) */
+  void filter(MatrixSliceRef data, const std::vector<std::complex<Double>> &H);
+
   /** @brief Frequency computation.
   * This function creates a frequency vector of half the length of an input
   * data vector. The output vector contains frequencies measured in cycles per time.
@@ -17,6 +17,143 @@
 #include "external/lapack/blas.h"
 #include "external/lapack/lapack.h"
 #include "base/matrix.h"
+#include <atomic>
+
+/***********************************************/
+/***** MatrixMemory ****************************/
+/***********************************************/
+
+namespace MatrixMemory
+{
+  constexpr UInt alignment       = 64;               // bytes
+  constexpr UInt smallBytes      = 512;              // smaller blocks are not aligned and not cached
+  constexpr UInt classCount      = 45;               // size classes in quarter power of two steps: 512 bytes ... 1 MB (including alignment)
+  constexpr UInt maxCachedBlocks = 16;               // per thread and size class
+  constexpr UInt maxCachedBytes  = 32*1024*1024;     // per thread
+
+  static std::atomic<UInt> countAllocations(0), countReused(0), bytesUsed(0), bytesPeak(0);
+
+  // 512, 640, 768, 896, 1024, 1280, ...
+  constexpr UInt classBytes(UInt idClass) {return (4+idClass%4) << (7+idClass/4);}
+
+  // cache of freed blocks, one per thread
+  class Cache
+  {
+  public:
+    std::vector<Double*> blocks[classCount];
+    UInt                 bytes = 0;
+   ~Cache();
+  };
+
+  static thread_local Bool isCacheDestroyed = FALSE; // static/thread_local matrices may be freed after the cache
+  static Cache &cache() {static thread_local Cache cache; return cache;}
+
+  static Double *allocateAligned(UInt bytes);
+  static void    freeAligned(Double *ptr);
+  static void    deallocate(Double *ptr, UInt idClass, UInt bytes);
+  static void    countAllocation(UInt bytes);
+}
+
+/***********************************************/
+
+MatrixMemory::Cache::~Cache()
+{
+  isCacheDestroyed = TRUE;
+  for(auto &list : blocks)
+    for(Double *ptr : list)
+      freeAligned(ptr);
+}
+
+/***********************************************/
+
+// the pointer returned by operator new is stored in front of the aligned block
+// bytes includes the alignment padding
+Double *MatrixMemory::allocateAligned(UInt bytes)
+{
+  char *raw = static_cast<char*>(::operator new(bytes));
+  char *ptr = raw + alignment - (reinterpret_cast<std::uintptr_t>(raw) % alignment);
+  reinterpret_cast<void**>(ptr)[-1] = raw;
+  return reinterpret_cast<Double*>(ptr);
+}
+
+/***********************************************/
+
+void MatrixMemory::freeAligned(Double *ptr)
+{
+  ::operator delete(reinterpret_cast<void**>(ptr)[-1]);
+}
+
+/***********************************************/
+
+std::shared_ptr<Double> MatrixMemory::allocate(UInt size)
+{
+  const UInt bytesRequested = std::max(size, UInt(1)) * sizeof(Double);
+
+  // small blocks directly from the heap
+  if(bytesRequested <= smallBytes)
+  {
+    countAllocation(bytesRequested);
+    return std::shared_ptr<Double>(static_cast<Double*>(::operator new(bytesRequested)),
+                                   [bytesRequested](Double *p) {bytesUsed -= bytesRequested; ::operator delete(p);});
+  }
+
+  UInt idClass = 0;
+  while((idClass < classCount) && (classBytes(idClass) < bytesRequested+alignment))
+    idClass++;
+  const UInt bytes = (idClass < classCount) ? classBytes(idClass) : (bytesRequested+alignment);
+
+  Double *ptr = nullptr;
+  if((idClass < classCount) && !isCacheDestroyed && cache().blocks[idClass].size())
+  {
+    ptr = cache().blocks[idClass].back();
+    cache().blocks[idClass].pop_back();
+    cache().bytes -= bytes;
+    countReused++;
+  }
+  else
+    ptr = allocateAligned(bytes);
+  countAllocation(bytes);
+
+  return std::shared_ptr<Double>(ptr, [idClass, bytes](Double *p) {deallocate(p, idClass, bytes);});
+}
+
+/***********************************************/
+
+void MatrixMemory::countAllocation(UInt bytes)
+{
+  countAllocations++;
+  const UInt used = (bytesUsed += bytes);
+  UInt peak = bytesPeak.load(std::memory_order_relaxed);
+  while((used > peak) && !bytesPeak.compare_exchange_weak(peak, used))
+    ;
+}
+
+/***********************************************/
+
+void MatrixMemory::deallocate(Double *ptr, UInt idClass, UInt bytes)
+{
+  bytesUsed -= bytes;
+  if((idClass < classCount) && !isCacheDestroyed)
+  {
+    Cache &cache = MatrixMemory::cache();
+    if((cache.blocks[idClass].size() < maxCachedBlocks) && (cache.bytes+bytes <= maxCachedBytes))
+    {
+      cache.blocks[idClass].push_back(ptr);
+      cache.bytes += bytes;
+      return;
+    }
+  }
+  freeAligned(ptr);
+}
+
+/***********************************************/
+
+void MatrixMemory::statistics(UInt &allocations, UInt &reused, UInt &peakBytes)
+{
+  allocations = countAllocations;
+  reused      = countReused;
+  peakBytes   = bytesPeak;
+}
 
 /***********************************************/
 /***** MatrixBase ******************************/
@@ -26,7 +163,7 @@ MatrixBase::MatrixBase(UInt size) : _size(size)
 {
   try
   {
-    ptr = std::shared_ptr<Double>(new Double[_size], std::default_delete<Double[]>());
+    ptr = MatrixMemory::allocate(_size);
   }
   catch(std::exception &e)
   {
@@ -79,6 +216,144 @@ const_MatrixSlice const_MatrixSlice::slice(UInt startRow, UInt startColumn, UInt
   }
 }
 
+Matrix const_MatrixSlice::allocateLike() const
+{
+  Matrix C;
+  C._rows    = _rows;
+  C._columns = _columns;
+  C._ld      = _rows;
+  C._type    = _type;
+  C._uplo    = _uplo;
+  if(size())
+    C.base = std::make_shared<MatrixBase>(size());
+  return C;
+}
+
+/***********************************************/
+
+// C = op(A) element wise in a single pass (C is column major)
+template<typename Op>
+static void elementWise(const_MatrixSliceRef A, const MatrixSlice &C, Op op)
+{
+  if(!C.size())
+    return;
+  const Double *ptrA = A.field();
+        Double *ptrC = C.field();
+  const UInt    incA = A.isRowMajorOrder() ? A.ld() : 1;
+  const UInt    ldA  = A.isRowMajorOrder() ? 1 : A.ld();
+  for(UInt k=0; k<C.columns(); k++, ptrA+=ldA, ptrC+=C.ld())
+    if(incA == 1)
+      for(UInt i=0; i<C.rows(); i++)
+        ptrC[i] = op(ptrA[i]);
+    else
+      for(UInt i=0; i<C.rows(); i++)
+        ptrC[i] = op(ptrA[i*incA]);
+}
+
+/***********************************************/
+
+// C = op(A, B) element wise in a single pass (C is column major)
+template<typename Op>
+static void elementWise(const_MatrixSliceRef A, const_MatrixSliceRef B, const MatrixSlice &C, Op op)
+{
+  if((A.rows()!=B.rows()) || (A.columns()!=B.columns()))
+    throw(Exception("Dimension error: ("+A.rows()%"%i x "s+A.columns()%"%i)  and ("s+B.rows()%"%i x "s+B.columns()%"%i)"s));
+  if(!C.size())
+    return;
+  const Double *ptrA = A.field();
+  const Double *ptrB = B.field();
+        Double *ptrC = C.field();
+  const UInt    incA = A.isRowMajorOrder() ? A.ld() : 1;
+  const UInt    ldA  = A.isRowMajorOrder() ? 1 : A.ld();
+  const UInt    incB = B.isRowMajorOrder() ? B.ld() : 1;
+  const UInt    ldB  = B.isRowMajorOrder() ? 1 : B.ld();
+  for(UInt k=0; k<C.columns(); k++, ptrA+=ldA, ptrB+=ldB, ptrC+=C.ld())
+    if((incA == 1) && (incB == 1))
+      for(UInt i=0; i<C.rows(); i++)
+        ptrC[i] = op(ptrA[i], ptrB[i]);
+    else
+      for(UInt i=0; i<C.rows(); i++)
+        ptrC[i] = op(ptrA[i*incA], ptrB[i*incB]);
+}
+
+/***********************************************/
+
+Matrix const_MatrixSlice::operator+(Double c) const
+{
+  Matrix C = allocateLike();
+  elementWise(*this, C, [c](Double a) {return a+c;});
+  return C;
+}
+
+/***********************************************/
+
+Matrix const_MatrixSlice::operator-(Double c) const
+{
+  Matrix C = allocateLike();
+  elementWise(*this, C, [c](Double a) {return a-c;});
+  return C;
+}
+
+/***********************************************/
+
+Matrix const_MatrixSlice::operator*(Double c) const
+{
+  Matrix C = allocateLike();
+  elementWise(*this, C, [c](Double a) {return a*c;});
+  return C;
+}
+
+/***********************************************/
+
+Matrix const_MatrixSlice::operator/(Double c) const
+{
+  const Double cInv = 1./c;
+  Matrix C = allocateLike();
+  elementWise(*this, C, [cInv](Double a) {return a*cInv;});
+  return C;
+}
+
+/***********************************************/
+
+Matrix const_MatrixSlice::operator-() const
+{
+  Matrix C = allocateLike();
+  elementWise(*this, C, [](Double a) {return -a;});
+  return C;
+}
+
+/***********************************************/
+
+Matrix const_MatrixSlice::operator+(const const_MatrixSlice &x) const
+{
+  try
+  {
+    Matrix C = allocateLike();
+    elementWise(*this, x, C, [](Double a, Double b) {return a+b;});
+    return C;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix const_MatrixSlice::operator-(const const_MatrixSlice &x) const
+{
+  try
+  {
+    Matrix C = allocateLike();
+    elementWise(*this, x, C, [](Double a, Double b) {return a-b;});
+    return C;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***** MatrixSlice *****************************/
 /***********************************************/
@@ -568,6 +843,21 @@ Bool isStrictlyZero(const_MatrixSliceRef A)
 
 /***********************************************/
 
+// calls f(ptr, count) for each contiguous column (or row in row major order)
+template<typename F>
+static void forEachVector(const_MatrixSliceRef A, F f)
+{
+  if(!A.size())
+    return;
+  const UInt    count   = A.isRowMajorOrder() ? A.columns() : A.rows();
+  const UInt    vectors = A.isRowMajorOrder() ? A.rows() : A.columns();
+  const Double *ptr     = A.field();
+  for(UInt k=0; k<vectors; k++)
+    f(ptr+k*A.ld(), count);
+}
+
+/***********************************************/
+
 Double inner(const_MatrixSliceRef A, const_MatrixSliceRef B)
 {
   try
@@ -604,9 +894,11 @@ Double sum(const_MatrixSliceRef A)
   try
   {
     Double sum = 0;
-    for(UInt i=0; i<A.rows(); i++)
-      for(UInt k=0; k<A.columns(); k++)
-        sum += A(i,k);
+    forEachVector(A, [&](const Double *ptr, UInt count)
+    {
+      for(UInt i=0; i<count; i++)
+        sum += ptr[i];
+    });
     return sum;
   }
   catch(std::exception &e)
@@ -701,9 +993,11 @@ Double logdeterminant(const_MatrixSliceRef A, Double& sign)
 Double maxabs(const_MatrixSliceRef A)
 {
   Double d = 0;
-  for(UInt i=0; i<A.rows(); i++)
-    for(UInt k=0; k<A.columns(); k++)
-      d = std::max(d, std::fabs(A(i,k)));
+  forEachVector(A, [&](const Double *ptr, UInt count)
+  {
+    for(UInt i=0; i<count; i++)
+      d = std::max(d, std::fabs(ptr[i]));
+  });
   return A.size() ? d : NAN_EXPR;
 }
 
@@ -712,9 +1006,11 @@ Double maxabs(const_MatrixSliceRef A)
 Double min(const_MatrixSliceRef A)
 {
   Double d = std::numeric_limits<double>::max();
-  for(UInt i=0; i<A.rows(); i++)
-    for(UInt k=0; k<A.columns(); k++)
-      d = std::min(d, A(i,k));
+  forEachVector(A, [&](const Double *ptr, UInt count)
+  {
+    for(UInt i=0; i<count; i++)
+      d = std::min(d, ptr[i]);
+  });
   return A.size() ? d : NAN_EXPR;
 }
 
@@ -722,10 +1018,12 @@ Double min(const_MatrixSliceRef A)
 
 Double max(const_MatrixSliceRef A)
 {
-  Double d = std::numeric_limits<double>::min();
-  for(UInt i=0; i<A.rows(); i++)
-    for(UInt k=0; k<A.columns(); k++)
-      d = std::max(d, A(i,k));
+  Double d = std::numeric_limits<double>::lowest();
+  forEachVector(A, [&](const Double *ptr, UInt count)
+  {
+    for(UInt i=0; i<count; i++)
+      d = std::max(d, ptr[i]);
+  });
   return A.size() ? d : NAN_EXPR;
 }
 
@@ -113,13 +113,14 @@ public:
   * @see field() */
   Bool isRowMajorOrder() const {return _rowMajorOrder;}
 
-  inline Matrix operator+(Double c)                   const;
-  inline Matrix operator-(Double c)                   const;
-  inline Matrix operator*(Double c)                   const;
-  inline Matrix operator/(Double c)                   const;
-  inline Matrix operator-()                           const;
-  inline Matrix operator+(const const_MatrixSlice &x) const;
-  inline Matrix operator-(const const_MatrixSlice &x) const;
+  // element wise operations are computed in a single pass into a new matrix
+  Matrix operator+(Double c)                   const;
+  Matrix operator-(Double c)                   const;
+  Matrix operator*(Double c)                   const;
+  Matrix operator/(Double c)                   const;
+  Matrix operator-()                           const;
+  Matrix operator+(const const_MatrixSlice &x) const;
+  Matrix operator-(const const_MatrixSlice &x) const;
 
 protected:
   UInt _rows,  _columns;
@@ -130,6 +131,7 @@ protected:
   std::shared_ptr<MatrixBase> base;
 
   const_MatrixSlice(UInt rows, UInt columns, const_MatrixSlice::Type type, const_MatrixSlice::Uplo uplo, Double fill=0);
+  Matrix allocateLike() const; // same dimension and type, elements not initialized
 
   friend class MatrixSlice;
   friend class Matrix;
@@ -663,6 +665,25 @@ void generateQ(MatrixSliceRef A, const Vector &tau);
 /***** CLASS ***********************************/
 /***********************************************/
 
+/** @brief Internal memory pool for the elements of matrices.
+* Blocks up to 512 bytes are taken directly from the heap with their exact size.
+* Larger blocks are 64 byte aligned (SIMD, BLAS). Freed blocks up to 1 MB
+* are cached per thread in size classes of quarter power of two steps
+* (the alignment padding included) and reused by the next matrices of a similar size. */
+namespace MatrixMemory
+{
+  /** @brief Uninitialized memory for @p size elements. */
+  std::shared_ptr<Double> allocate(UInt size);
+
+  /** @brief Statistics of this process.
+  * @param[out] allocations number of allocated memory blocks.
+  * @param[out] reused number of blocks reused from the cache.
+  * @param[out] peakBytes maximum memory used by matrices at the same time. */
+  void statistics(UInt &allocations, UInt &reused, UInt &peakBytes);
+}
+
+/***********************************************/
+
 /** @brief Internal class.
 * Used for memory management of matrices.
 * Memory is only copied, if needed (copy on write).
@@ -698,7 +719,7 @@ inline Double *MatrixBase::field()
 {
   if(ptr.use_count()>1) // not threat save
   {
-    auto ptr2 = std::shared_ptr<Double>(new Double[size()], std::default_delete<Double[]>());
+    auto ptr2 = MatrixMemory::allocate(size());
     std::copy_n(ptr.get(), size(), ptr2.get());
     std::swap(ptr, ptr2);
   }
@@ -707,16 +728,6 @@ inline Double *MatrixBase::field()
 
 /***********************************************/
 
-inline Matrix const_MatrixSlice::operator+(Double c)                   const {return Matrix(*this) +=  c;}
-inline Matrix const_MatrixSlice::operator-(Double c)                   const {return Matrix(*this) -=  c;}
-inline Matrix const_MatrixSlice::operator*(Double c)                   const {return Matrix(*this) *=  c;}
-inline Matrix const_MatrixSlice::operator/(Double c)                   const {return Matrix(*this) /=  c;}
-inline Matrix const_MatrixSlice::operator-()                           const {return Matrix(*this) *= -1;}
-inline Matrix const_MatrixSlice::operator+(const const_MatrixSlice &x) const {return Matrix(*this) +=  x;}
-inline Matrix const_MatrixSlice::operator-(const const_MatrixSlice &x) const {return Matrix(*this) -=  x;}
-
-/***********************************************/
-
 inline const Double *const_MatrixSlice::field() const
 {
   if(!base)
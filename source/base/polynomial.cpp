@@ -11,6 +11,7 @@
 /***********************************************/
 
 #include "base/importStd.h"
+#include <map>
 #include "base/polynomial.h"
 
 /***********************************************/
@@ -38,6 +39,11 @@ void Polynomial::init(const std::vector<Time> &times, UInt degree, Bool throwExc
     for(UInt i=0; i<isConstInterval.size(); i++)
       isConstInterval.at(i) = (std::fabs((times.at(i+1)-times.at(i)).seconds()-sampling) < margin);
 
+    irregularCount.resize(times.size());
+    irregularCount.at(0) = 0;
+    for(UInt i=0; i<isConstInterval.size(); i++)
+      irregularCount.at(i+1) = irregularCount.at(i) + (isConstInterval.at(i) ? 0 : 1);
+
     isPrecomputed.clear();
     isPrecomputed.resize(times.size()-degree, TRUE);
     if(degree > 0)
@@ -69,6 +75,11 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
     if(!derivative && !isLeastSquares && (timesNew == times)) // need interpolation?
       return A;
 
+    // coefficients of equidistant stencils depend only on the offset of the new epoch
+    // to the first stencil point (integer nanoseconds) -> reused for regular output sampling
+    constexpr UInt maxCacheSize = 10000;
+    std::map<std::pair<UInt, Int64>, Vector> coeffCache;
+
     Matrix B(rowsPerEpoch*(adjoint ? times.size() : timesNew.size()), A.columns());
     auto searchStart = times.begin();
     for(UInt i=0; i<timesNew.size(); i++)
@@ -133,8 +144,16 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
 
       // compute interpolation coefficients
       // ----------------------------------
+      const Bool isEquidistant = (irregularCount.at(idx+count-1) == irregularCount.at(idx));
+      const auto key = std::make_pair(count, static_cast<Int64>(std::llround(1e9*(timesNew.at(i)-times.at(idx)).seconds())));
+      auto iter = isEquidistant ? coeffCache.find(key) : coeffCache.end();
+
       Vector coeff;
-      if(!isLeastSquares && isPrecomputed.at(idx))
+      if(iter != coeffCache.end())
+      {
+        coeff = iter->second;
+      }
+      else if(!isLeastSquares && isPrecomputed.at(idx))
       {
         const Double tau = (timesNew.at(i)-times.at(idx)).seconds()/sampling - degree/2.;
         coeff = Vector(W.rows());
@@ -154,7 +173,7 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
         Matrix P(count, degree+1);
         for(UInt k=0; k<count; k++)
         {
-          const Double factor = (timesNew.at(i)-times.at(idx+k)).seconds()/sampling;
+          const Double factor = (times.at(idx+k)-timesNew.at(i)).seconds()/sampling;
           P(k,0) = 1.0;
           for(UInt n=1; n<=degree; n++)
             P(k,n) = factor * P(k,n-1);
@@ -175,6 +194,8 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
           solveInPlace(Matrix(P.trans()), coeff);
         }
       }
+      if(isEquidistant && (iter == coeffCache.end()) && (coeffCache.size() < maxCacheSize))
+        coeffCache[key] = coeff;
 
       // interpolate
       // -----------
@@ -205,3 +226,153 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
 }
 
 /***********************************************/
+
+void PolynomialPiecewise3d::init(const Polynomial &polynomial, const_MatrixSliceRef A)
+{
+  try
+  {
+    if(!polynomial.times.size())
+      throw(Exception("polynomial not initialized"));
+    if(A.columns() != 3)
+      throw(Exception("input data must have 3 columns (x,y,z)"));
+    if(A.rows() != polynomial.times.size())
+      throw(Exception("size mismatch: "+A.rows()%"%i rows, "s+polynomial.times.size()%"%i epochs"s));
+
+    this->polynomial = polynomial;
+    this->A          = A;
+    time0            = polynomial.times.front();
+    sampling         = polynomial.sampling;
+    t.resize(polynomial.times.size());
+    for(UInt i=0; i<t.size(); i++)
+      t.at(i) = (polynomial.times.at(i)-time0).seconds();
+
+    // Chebyshev nodes in [-1,1] and inverse Vandermonde matrix
+    const UInt count = polynomial.degree+1;
+    std::vector<Double> x(count);
+    for(UInt k=0; k<count; k++)
+      x.at(k) = -std::cos(PI*(2*k+1)/(2*count));
+    Matrix V(count, count);
+    for(UInt k=0; k<count; k++)
+    {
+      V(k,0) = 1.;
+      for(UInt n=1; n<count; n++)
+        V(k,n) = x.at(k) * V(k,n-1);
+    }
+    inverse(V);
+
+    // interpolate at the nodes of each half interval
+    const UInt segmentCount = 2*(t.size()-1);
+    std::vector<Time> times;
+    times.reserve(segmentCount*count);
+    for(UInt s=0; s<segmentCount; s++)
+    {
+      const Double halfWidth = 0.25*(t.at(s/2+1)-t.at(s/2));
+      const Double center    = ((s%2) ? 3 : 1) * halfWidth;
+      for(UInt k=0; k<count; k++)
+        times.push_back(polynomial.times.at(s/2) + seconds2time(center+halfWidth*x.at(k)));
+    }
+    Polynomial polynomialNodes = polynomial;
+    polynomialNodes.throwException = FALSE;
+    const Matrix B = polynomialNodes.interpolate(times, A);
+
+    // polynomial coefficients
+    coeff.resize(segmentCount*count*3);
+    isValid.resize(segmentCount);
+    for(UInt s=0; s<segmentCount; s++)
+    {
+      Matrix C(count, 3);
+      matMult(1., V, B.row(s*count, count), C);
+      isValid.at(s) = !std::any_of(C.field(), C.field()+C.size(), [](Double c){return std::isnan(c);});
+      for(UInt n=0; n<count; n++)
+        for(UInt i=0; i<3; i++)
+          coeff.at((s*count+n)*3+i) = C(n,i);
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void PolynomialPiecewise3d::interpolate(const Time &time, UInt derivativeCount, Vector3d &value, Vector3d &derivative, Vector3d &derivative2) const
+{
+  try
+  {
+    // find interval
+    // -------------
+    const Double tau = (time-time0).seconds();
+    UInt idx = NULLINDEX;
+    if((t.size() > 1) && (tau >= t.front()) && (tau <= t.back()))
+    {
+      // first guess for equidistant epochs
+      idx = std::min(static_cast<UInt>(tau/sampling), t.size()-2);
+      for(UInt steps=0; (steps<4) && (idx > 0) && (t.at(idx) > tau); steps++)
+        idx--;
+      for(UInt steps=0; (steps<4) && (idx+2 < t.size()) && (t.at(idx+1) < tau); steps++)
+        idx++;
+      if((t.at(idx) > tau) || (t.at(idx+1) < tau)) // irregular epochs
+        idx = std::min(static_cast<UInt>(std::distance(t.begin(), std::upper_bound(t.begin(), t.end(), tau))), t.size()-1) - 1;
+    }
+
+    const Double halfWidth = (idx != NULLINDEX) ? 0.25*(t.at(idx+1)-t.at(idx)) : 0.;
+    const UInt   segment   = (idx != NULLINDEX) ? (2*idx + ((tau >= t.at(idx)+2*halfWidth) ? 1 : 0)) : NULLINDEX;
+
+    // outside or data gap -> direct interpolation
+    // -------------------------------------------
+    if((segment == NULLINDEX) || !isValid.at(segment))
+    {
+      value = Vector3d(polynomial.interpolate({time}, A, 1, 0));
+      if(derivativeCount > 0)
+        derivative = Vector3d(polynomial.interpolate({time}, A, 1, 1));
+      if(derivativeCount > 1)
+        derivative2 = Vector3d(polynomial.interpolate({time}, A, 1, 2));
+      return;
+    }
+
+    // Horner scheme
+    // -------------
+    const Double x     = (tau-t.at(idx)-((segment%2) ? 3 : 1)*halfWidth)/halfWidth;
+    const UInt   count = coeff.size()/(3*isValid.size());
+    const Double *c    = coeff.data() + (segment*count+count-1)*3;
+    Double v[3]  = {c[0], c[1], c[2]};
+    Double d1[3] = {0., 0., 0.};
+    Double d2[3] = {0., 0., 0.};
+    for(UInt n=count-1; n-->0;)
+    {
+      c -= 3;
+      for(UInt i=0; i<3; i++)
+      {
+        d2[i] = d2[i]*x + 2*d1[i];
+        d1[i] = d1[i]*x + v[i];
+        v[i]  = v[i]*x  + c[i];
+      }
+    }
+    value       = Vector3d(v[0], v[1], v[2]);
+    derivative  = (1./halfWidth) * Vector3d(d1[0], d1[1], d1[2]);
+    derivative2 = (1./(halfWidth*halfWidth)) * Vector3d(d2[0], d2[1], d2[2]);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Vector3d PolynomialPiecewise3d::interpolate(const Time &time) const
+{
+  Vector3d value, derivative, derivative2;
+  interpolate(time, 0, value, derivative, derivative2);
+  return value;
+}
+
+/***********************************************/
+
+void PolynomialPiecewise3d::interpolate(const Time &time, Vector3d &value, Vector3d &derivative, Vector3d &derivative2) const
+{
+  interpolate(time, 2, value, derivative, derivative2);
+}
+
+/***********************************************/
@@ -15,6 +15,7 @@
 
 #include "base/importStd.h"
 #include "base/matrix.h"
+#include "base/vector3d.h"
 #include "base/time.h"
 
 /***** CLASS ***********************************/
@@ -30,8 +31,11 @@ class Polynomial
   Bool              isLeastSquares;
   Double            range, extrapolation;
   std::vector<Bool> isPrecomputed;
+  std::vector<UInt> irregularCount; // cumulative number of non equidistant intervals
   Matrix            W;
 
+  friend class PolynomialPiecewise3d;
+
 public:
   /// Constructor
   Polynomial() {}
@@ -87,6 +91,48 @@ public:
   Matrix derivative2nd(const std::vector<Time> &timesNew, const_MatrixSliceRef A, UInt rowsPerEpoch=1) const {return interpolate(timesNew, A, rowsPerEpoch, 2);}
 };
 
+/***** CLASS ***********************************/
+
+/** @brief Precomputed piecewise polynomial of a 3D time series (e.g. orbit positions).
+* The interpolation polynomials of @a Polynomial are converted once into
+* coefficients for each half interval between the input epochs.
+* The evaluation at a single epoch is allocation free and finds the segment
+* in constant time for (nearly) equidistant input epochs.
+* Epochs outside the input epochs or in segments which could not be
+* interpolated (data gaps) are computed with @a Polynomial directly.
+* @ingroup base */
+class PolynomialPiecewise3d
+{
+  Polynomial          polynomial;
+  Matrix              A;
+  Time                time0;
+  Double              sampling;
+  std::vector<Double> t;      // input epochs [seconds] relative to time0
+  std::vector<Double> coeff;  // (segment, power, xyz)
+  std::vector<Bool>   isValid;
+
+  void interpolate(const Time &time, UInt derivativeCount, Vector3d &value, Vector3d &derivative, Vector3d &derivative2) const;
+
+public:
+  /// Constructor
+  PolynomialPiecewise3d() : sampling(0) {}
+
+  /** @brief Constructor.
+  * @see init(const Polynomial &, const_MatrixSliceRef) */
+  PolynomialPiecewise3d(const Polynomial &polynomial, const_MatrixSliceRef A) {init(polynomial, A);}
+
+  /** @brief Initialize the interpolator.
+  * @param polynomial initialized with the epochs of the input data.
+  * @param A input data (epochs x (x,y,z)). */
+  void init(const Polynomial &polynomial, const_MatrixSliceRef A);
+
+  /** @brief Interpolated value at @p time. */
+  Vector3d interpolate(const Time &time) const;
+
+  /** @brief Interpolated value and first and second derivative [1/s, 1/s^2] at @p time. */
+  void interpolate(const Time &time, Vector3d &value, Vector3d &derivative, Vector3d &derivative2) const;
+};
+
 /***********************************************/
 
 #endif /* __GROOPS_POLYNOMIAL__ */
@@ -14,6 +14,7 @@
 #include "base/importStd.h"
 #include "base/string.h"
 #include <regex>
+#include <cstdio>
 
 /***********************************************/
 
@@ -94,12 +95,10 @@ Double String::toDouble(const std::string &str)
     if(std::all_of(str.begin(), str.end(), ::isspace))
       return 0.;
 
-    std::string str2 = str;
-    auto dpos = str.find_first_of("Dd");
-    if(dpos != std::string::npos)
-      str2[dpos] = 'e';
-
-    return std::stod(str2);
+    Double x;
+    if(parseDouble(str.c_str(), x) == str.c_str())
+      throw(Exception("no number found"));
+    return x;
   }
   catch(std::exception &e)
   {
@@ -116,7 +115,10 @@ Int String::toInt(const std::string &str)
     if(std::all_of(str.begin(), str.end(), ::isspace))
       return 0;
 
-    return std::stoi(str);
+    Int x;
+    if(parseInt(str.c_str(), x) == str.c_str())
+      throw(Exception("no number found"));
+    return x;
   }
   catch(std::exception &e)
   {
@@ -126,6 +128,228 @@ Int String::toInt(const std::string &str)
 
 /***********************************************/
 
+// copies the column into a zero terminated buffer (parsing must stop at the end of the column)
+template<typename T>
+static T parseColumn(const std::string &line, UInt pos, UInt len, const char *(*parse)(const char*, T&), const char *typeName)
+{
+  if(pos > line.size())
+    throw(Exception("column "+pos%"%i exceeds line length "s+line.size()%"%i: "s+line));
+  len = std::min(len, static_cast<UInt>(line.size()-pos));
+  char buffer[64];
+  if(len >= sizeof(buffer))
+    throw(Exception("column width "+len%"%i too large"s));
+  std::copy_n(line.data()+pos, len, buffer);
+  buffer[len] = '\0';
+
+  const char *ptr = buffer;
+  while(std::isspace(static_cast<unsigned char>(*ptr)))
+    ptr++;
+  T x = 0;
+  if(*ptr && (parse(ptr, x) == ptr))
+    throw(Exception("cannot read "+std::string(typeName)+" from string '"+buffer+"'"));
+  return x;
+}
+
+/***********************************************/
+
+Double String::toDouble(const std::string &line, UInt pos, UInt len)
+{
+  try
+  {
+    return parseColumn<Double>(line, pos, len, &String::parseDouble, "double");
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Int String::toInt(const std::string &line, UInt pos, UInt len)
+{
+  try
+  {
+    return parseColumn<Int>(line, pos, len, &String::parseInt, "integer");
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+const char *String::parseDouble(const char *str, Double &x)
+{
+  // exactly representable powers of ten
+  static constexpr Double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  const char *ptr = str;
+  while(std::isspace(static_cast<unsigned char>(*ptr)))
+    ptr++;
+  const char *start = ptr;
+  const Bool isNegative = (*ptr == '-');
+  if((*ptr == '-') || (*ptr == '+'))
+    ptr++;
+
+  // mantissa: up to 19 significant digits fit into 64 bit
+  UInt64 mantissa = 0;
+  Int    digits   = 0; // significant digits
+  Int    exponent = 0;
+  Bool   hasDigits = FALSE;
+  for(; std::isdigit(static_cast<unsigned char>(*ptr)); ptr++)
+  {
+    hasDigits = TRUE;
+    if(digits < 19)
+    {
+      mantissa = 10*mantissa + (*ptr-'0');
+      if(mantissa)
+        digits++;
+    }
+    else
+    {
+      digits++;
+      exponent++;
+    }
+  }
+  if(*ptr == '.')
+  {
+    ptr++;
+    for(; std::isdigit(static_cast<unsigned char>(*ptr)); ptr++)
+    {
+      hasDigits = TRUE;
+      if(digits < 19)
+      {
+        mantissa = 10*mantissa + (*ptr-'0');
+        exponent--;
+        if(mantissa)
+          digits++;
+      }
+      else
+        digits++;
+    }
+  }
+
+  if(!hasDigits) // nan, inf?
+  {
+    char *end;
+    x = std::strtod(start, &end);
+    return (end == start) ? str : end;
+  }
+
+  // exponent (Fortran: D/d)
+  if((*ptr == 'e') || (*ptr == 'E') || (*ptr == 'd') || (*ptr == 'D'))
+  {
+    const char *ptrExp = ptr+1;
+    const Bool isNegativeExp = (*ptrExp == '-');
+    if((*ptrExp == '-') || (*ptrExp == '+'))
+      ptrExp++;
+    if(std::isdigit(static_cast<unsigned char>(*ptrExp)))
+    {
+      Int e = 0;
+      for(; std::isdigit(static_cast<unsigned char>(*ptrExp)); ptrExp++)
+        if(e < 100000)
+          e = 10*e + (*ptrExp-'0');
+      exponent += (isNegativeExp) ? -e : e;
+      ptr = ptrExp;
+    }
+  }
+
+  // fast path: mantissa and power of ten are exact -> a single rounding
+  if((digits <= 19) && (mantissa <= (UInt64(1)<<53)) && (std::abs(exponent) <= 22))
+  {
+    x = static_cast<Double>(mantissa);
+    x = (exponent < 0) ? x/pow10[-exponent] : x*pow10[exponent];
+    if(isNegative)
+      x = -x;
+    return ptr;
+  }
+
+  // extended precision (64 bit mantissa) holds up to 19 digits and powers of ten up to 1e27 exactly
+  // -> a single rounding as well, the second rounding to Double is only wrong for ties
+  static const Bool isExtendedPrecision = []()
+  {
+    volatile LongDouble one = 1, tiny = std::ldexp(static_cast<LongDouble>(1), -63);
+    return (std::numeric_limits<LongDouble>::digits == 64) && (one+tiny != one);
+  }();
+  if(isExtendedPrecision && (digits <= 19) && (std::abs(exponent) <= 27))
+  {
+    static const LongDouble pow10Extended[] = {1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,  1e7L,  1e8L,  1e9L,
+                                               1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+                                               1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L};
+    LongDouble y = static_cast<LongDouble>(mantissa);
+    y = (exponent < 0) ? y/pow10Extended[-exponent] : y*pow10Extended[exponent];
+    Int exponent2;
+    const UInt64 bits = static_cast<UInt64>(std::ldexp(std::frexp(y, &exponent2), 64));
+    if((bits & 0x7FF) != 0x400) // not a tie
+    {
+      x = static_cast<Double>(isNegative ? -y : y);
+      return ptr;
+    }
+  }
+
+  // correctly rounded conversion of the remaining cases
+  char buffer[64];
+  const UInt size = ptr-start;
+  if(size < sizeof(buffer))
+  {
+    std::copy(start, ptr, buffer);
+    buffer[size] = '\0';
+    std::replace(buffer, buffer+size, 'd', 'e');
+    std::replace(buffer, buffer+size, 'D', 'e');
+    x = std::strtod(buffer, nullptr);
+  }
+  else
+  {
+    std::string number(start, ptr);
+    std::replace(number.begin(), number.end(), 'd', 'e');
+    std::replace(number.begin(), number.end(), 'D', 'e');
+    x = std::strtod(number.c_str(), nullptr);
+  }
+  return ptr;
+}
+
+/***********************************************/
+
+const char *String::parseInt(const char *str, Int &x)
+{
+  const char *ptr = str;
+  while(std::isspace(static_cast<unsigned char>(*ptr)))
+    ptr++;
+  const Bool isNegative = (*ptr == '-');
+  if((*ptr == '-') || (*ptr == '+'))
+    ptr++;
+  if(!std::isdigit(static_cast<unsigned char>(*ptr)))
+    return str;
+  Int64 value = 0;
+  for(; std::isdigit(static_cast<unsigned char>(*ptr)); ptr++)
+    if(value <= std::numeric_limits<Int>::max())
+      value = 10*value + (*ptr-'0');
+  if(value > std::numeric_limits<Int>::max()+Int64(isNegative))
+    return str; // out of range
+  x = static_cast<Int>(isNegative ? -value : value);
+  return ptr;
+}
+
+/***********************************************/
+
+UInt String::formatDouble(Double x, char *buffer)
+{
+  // 17 significant digits are always sufficient
+  Int size = 0;
+  for(Int precision=15; precision<=17; precision++)
+  {
+    size = std::snprintf(buffer, 32, "%.*g", precision, x);
+    if(!std::isfinite(x) || (std::strtod(buffer, nullptr) == x))
+      break;
+  }
+  return static_cast<UInt>(size);
+}
+
+/***********************************************/
+
 Bool String::contains(const std::string &str, const std::string &test)
 {
   return str.size() && (str.find(test) != std::string::npos);
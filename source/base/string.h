@@ -47,6 +47,31 @@ namespace String
   /** @brief Convert to Int. Returns 0 if substring is all white spaces. */
   Int toInt(const std::string &str);
 
+  /** @brief Convert the column @p pos with @p len characters of a fixed format @p line to Double.
+  * Same as toDouble(line.substr(pos, len)) but without a temporary string. */
+  Double toDouble(const std::string &line, UInt pos, UInt len);
+
+  /** @brief Convert the column @p pos with @p len characters of a fixed format @p line to Int.
+  * Same as toInt(line.substr(pos, len)) but without a temporary string. */
+  Int toInt(const std::string &line, UInt pos, UInt len);
+
+  /** @brief Fast conversion of the number at the beginning of @p str to Double.
+  * Leading white spaces are skipped, Fortran exponents (e.g. 1.0D+00) are accepted.
+  * The conversion does not allocate memory and is exact (correctly rounded).
+  * @return pointer to the first character after the number or @p str if no number is found. */
+  const char *parseDouble(const char *str, Double &x);
+
+  /** @brief Fast conversion of the number at the beginning of @p str to Int.
+  * Leading white spaces are skipped.
+  * @return pointer to the first character after the number or @p str if no number is found. */
+  const char *parseInt(const char *str, Int &x);
+
+  /** @brief Shortest representation of @p x which is read back exactly.
+  * @param x number to convert.
+  * @param[out] buffer at least 32 characters, the result is null-terminated.
+  * @return number of written characters. */
+  UInt formatDouble(Double x, char *buffer);
+
   /** @brief test whether the @a str contains @p test. */
   Bool contains(const std::string &str, const std::string &test);
 
@@ -0,0 +1,677 @@
+/***********************************************/
+/**
+* @file groopsBench.cpp
+*
+* @brief Micro and macro benchmarks of core functions.
+*
+* @author agent
+* @date 2026-10-18
+*
+*/
+/***********************************************/
+
+/**
+@verbatim
+GROOPS benchmark suite
+Usage: groopsBench [--filter <text>] [--repeat <count>] [--min-time <seconds>] [--output <result.json>] [--baseline <baseline.json>] [--tolerance <0.2>] [--list]
+
+-h, --help           this text
+-l, --list           list the names of the benchmarks
+-f, --filter         run only benchmarks containing the text in the name (can be given multiple times)
+-r, --repeat         number of measurements of each benchmark (default: 5)
+-t, --min-time       minimum time of a single measurement [s], fast kernels are repeated (default: 0.1)
+-o, --output         write the results as JSON
+-b, --baseline       compare the results with a JSON file written before with --output
+-T, --tolerance      relative increase of the median time marked as regression (default: 0.2)
+@endverbatim
+
+All benchmarks run on generated data. The exit code is nonzero if a regression against the baseline is detected.
+Build with: cmake --build . --target groopsBench
+*/
+
+#include "base/import.h"
+#include "base/string.h"
+#include "base/fourier.h"
+#include "base/legendreFunction.h"
+#include "base/sphericalHarmonics.h"
+#include "parser/expressionParser.h"
+#include "inputOutput/file.h"
+#include "inputOutput/system.h"
+#include "files/fileMatrix.h"
+#include "parallel/parallel.h"
+#include "parallel/matrixDistributed.h"
+#include <chrono>
+#include <random>
+
+/***********************************************/
+
+/** @brief A single benchmark.
+* @a init generates the data and returns the function to be measured.
+* If @a bytes is given, the throughput is reported in MB/s. */
+class Benchmark
+{
+public:
+  std::string name;
+  std::function<std::function<void()>()> init;
+  Double bytes = 0; // processed data per call
+};
+
+/** @brief Timing of a benchmark [s per call]. */
+class BenchmarkResult
+{
+public:
+  std::string name;
+  UInt   iterations;
+  Double min, median, mean;
+  Double bytes;
+};
+
+/***********************************************/
+
+static Matrix randomMatrix(UInt rows, UInt columns, std::mt19937 &generator)
+{
+  std::normal_distribution<Double> normal;
+  Matrix A(rows, columns);
+  for(UInt z=0; z<rows; z++)
+    for(UInt s=0; s<columns; s++)
+      A(z,s) = normal(generator);
+  return A;
+}
+
+/***********************************************/
+
+static SphericalHarmonics randomHarmonics(UInt maxDegree, std::mt19937 &generator)
+{
+  std::normal_distribution<Double> normal;
+  Matrix cnm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+  Matrix snm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+  for(UInt n=2; n<=maxDegree; n++)
+    for(UInt m=0; m<=n; m++)
+    {
+      cnm(n,m) = 1e-5/(n*n)*normal(generator);
+      if(m) snm(n,m) = 1e-5/(n*n)*normal(generator);
+    }
+  return SphericalHarmonics(DEFAULT_GM, DEFAULT_R, cnm, snm);
+}
+
+/***********************************************/
+
+/** @brief Regular geographical grid with @a rows latitudes (cell centers). */
+static void regularGrid(UInt rows, std::vector<Vector3d> &points, std::vector<Double> &areas)
+{
+  const UInt   cols = 2*rows;
+  const Double dphi = PI/rows;
+  for(UInt i=0; i<rows; i++)
+  {
+    const Double phi = PI/2-(i+0.5)*dphi;
+    for(UInt k=0; k<cols; k++)
+    {
+      points.push_back(polar(Angle((k+0.5)*dphi), Angle(phi), DEFAULT_R));
+      areas.push_back(dphi*dphi*std::cos(phi));
+    }
+  }
+}
+
+/***********************************************/
+
+/** @brief Text of @a count random numbers with fixed @a width, 10 numbers per line. */
+static std::string numberText(UInt count, Int width, Int precision, Bool science, Double scale, std::mt19937 &generator)
+{
+  std::normal_distribution<Double> normal;
+  std::string text;
+  char buffer[64];
+  for(UInt i=0; i<count; i++)
+  {
+    text.append(buffer, std::snprintf(buffer, sizeof(buffer), (science) ? "%*.*e" : "%*.*f", width, precision, scale*normal(generator)));
+    text.push_back((i%10 == 9) ? '\n' : ' ');
+  }
+  return text;
+}
+
+/***********************************************/
+
+/** @brief Former InArchiveAscii::readDouble() (stream extraction and std::stod) as reference. */
+static Double readDoubleStream(std::istream &stream)
+{
+  std::string dummy;
+  stream>>dummy;
+  auto dpos = dummy.find_first_of("Dd");
+  if(dpos != std::string::npos)
+    dummy[dpos] = 'e';
+  return std::stod(dummy);
+}
+
+/***********************************************/
+
+/** @brief Former OutArchiveAscii::saveDouble() (stream formatting) as reference. */
+static void saveDoubleStream(std::ostream &stream, Double x, Int width, Int precision, Bool science)
+{
+  if(science)
+    stream.setf(std::ios::scientific,std::ios::floatfield);
+  else
+    stream.setf(std::ios::fixed,std::ios::floatfield);
+  stream.width(width);
+  stream.precision(precision);
+  stream<<x;
+}
+
+/***********************************************/
+
+static std::vector<Benchmark> benchmarkList(Parallel::CommunicatorPtr comm, const FileName &fileNameTmp)
+{
+  std::vector<Benchmark> list;
+  auto generator = std::make_shared<std::mt19937>(42);
+
+  // matrix kernels
+  // --------------
+  for(UInt n : {200, 1000})
+    list.push_back({"matrix/rankKUpdate/"+n%"%i"s, [=]()
+    {
+      Matrix A = randomMatrix(2*n, n, *generator);
+      auto   N = std::make_shared<Matrix>(n, Matrix::SYMMETRIC);
+      return std::function<void()>([=]() {rankKUpdate(1., A, *N);});
+    }});
+
+  for(UInt n : {200, 1000, 2000})
+    list.push_back({"matrix/cholesky/"+n%"%i"s, [=]()
+    {
+      Matrix N(n, Matrix::SYMMETRIC);
+      rankKUpdate(1., randomMatrix(n+10, n, *generator), N);
+      return std::function<void()>([=]() {Matrix W = N; cholesky(W);});
+    }});
+
+  list.push_back({"matrix/eliminationParameter/1000x200x20", [=]()
+  {
+    Matrix A = randomMatrix(1000, 200, *generator);
+    Matrix B = randomMatrix(1000, 20,  *generator);
+    Matrix l = randomMatrix(1000, 1,   *generator);
+    return std::function<void()>([=]()
+    {
+      Matrix A2 = A; // copy on write
+      Matrix B2 = B;
+      Matrix l2 = l;
+      eliminationParameter(B2, A2, l2);
+    });
+  }});
+
+  // spherical harmonics
+  // -------------------
+  for(UInt degree : {60, 120, 240})
+  {
+    list.push_back({"sphericalHarmonics/legendreFunction/"+degree%"%i"s, [=]()
+    {
+      return std::function<void()>([=]() {for(UInt i=0; i<180; i++) LegendreFunction::compute(std::cos((i+0.5)*DEG2RAD), degree);});
+    }});
+
+    list.push_back({"sphericalHarmonics/synthesis/"+degree%"%i"s, [=]()
+    {
+      SphericalHarmonics harm = randomHarmonics(degree, *generator);
+      std::vector<Vector3d> points;
+      std::vector<Double>   areas;
+      regularGrid(30, points, areas);
+      return std::function<void()>([=]() {for(auto &p : points) harm.potential(p);});
+    }});
+
+    list.push_back({"sphericalHarmonics/analysis/"+degree%"%i"s, [=]()
+    {
+      std::vector<Vector3d> points;
+      std::vector<Double>   areas;
+      regularGrid(std::max(degree/2, UInt(30)), points, areas);
+      std::normal_distribution<Double> normal;
+      std::vector<Double> values(points.size());
+      for(auto &value : values)
+        value = normal(*generator);
+      return std::function<void()>([=]()
+      {
+        Matrix cnm(degree+1, degree+1), snm(degree+1, degree+1);
+        Matrix Cnm, Snm;
+        for(UInt i=0; i<points.size(); i++)
+        {
+          SphericalHarmonics::CnmSnm(normalize(points.at(i)), degree, Cnm, Snm);
+          axpy(values.at(i)*areas.at(i)/(4*PI), Cnm, cnm);
+          axpy(values.at(i)*areas.at(i)/(4*PI), Snm, snm);
+        }
+      });
+    }});
+  }
+
+  // FFT
+  // ---
+  for(UInt length : {1000, 1024, 1009, 65536, 86400})
+    list.push_back({"fourier/fft/"+length%"%i"s, [=]()
+    {
+      Vector data = randomMatrix(length, 1, *generator);
+      return std::function<void()>([=]() {Fourier::synthesis(Fourier::fft(data), (length%2)==0);});
+    }});
+  list.push_back({"fourier/filter/86400x3", [=]()
+  {
+    Matrix data = randomMatrix(86400, 3, *generator);
+    std::vector<std::complex<Double>> H((data.rows()+2)/2);
+    for(UInt i=0; i<H.size(); i++)
+      H.at(i) = 1./(1.+std::complex<Double>(0., i/1000.)); // first order lowpass
+    return std::function<void()>([=]() {Matrix x = data; Fourier::filter(x, H);});
+  }});
+
+  // number parsing and formatting of ASCII files:
+  // current implementation vs. former stream based implementation
+  // -------------------------------------------------------------
+  class NumberFormat
+  {
+  public:
+    std::string name;
+    Int    width, precision;
+    Bool   science;
+    Double scale;
+  };
+  const UInt numberCount = 100000;
+  for(const NumberFormat &format : {NumberFormat{"long", 25, 18, TRUE, 1.}, NumberFormat{"short", 12, 6, FALSE, 100.}})
+  {
+    const Double bytes = numberCount*(format.width+1.); // with separator
+    auto text = std::make_shared<std::string>(numberText(numberCount, format.width, format.precision, format.science, format.scale, *generator));
+    auto values = std::make_shared<std::vector<Double>>(numberCount);
+    std::stringstream ss(*text);
+    for(Double &x : *values)
+      x = readDoubleStream(ss);
+    Double bytesShortest = 0; // output of formatDouble has variable length
+    char buffer[32];
+    for(Double x : *values)
+      bytesShortest += String::formatDouble(x, buffer)+1.;
+
+    list.push_back({"number/"+format.name+"/parse/parseDouble", [=]()
+    {
+      return std::function<void()>([=]()
+      {
+        Double x;
+        for(const char *ptr=text->c_str(), *end; (end = String::parseDouble(ptr, x)) != ptr; ptr=end)
+          ;
+      });
+    }, bytes});
+
+    list.push_back({"number/"+format.name+"/parse/stream", [=]()
+    {
+      return std::function<void()>([=]()
+      {
+        std::stringstream ss(*text);
+        for(UInt i=0; i<numberCount; i++)
+          readDoubleStream(ss);
+      });
+    }, bytes});
+
+    list.push_back({"number/"+format.name+"/format/snprintf", [=]()
+    {
+      return std::function<void()>([=]()
+      {
+        std::stringstream ss;
+        char buffer[64];
+        for(Double x : *values)
+        {
+          ss.write(buffer, std::snprintf(buffer, sizeof(buffer), (format.science) ? "%*.*e" : "%*.*f", format.width, format.precision, x));
+          ss.put(' ');
+        }
+      });
+    }, bytes});
+
+    list.push_back({"number/"+format.name+"/format/stream", [=]()
+    {
+      return std::function<void()>([=]()
+      {
+        std::stringstream ss;
+        for(Double x : *values)
+        {
+          saveDoubleStream(ss, x, format.width, format.precision, format.science);
+          ss.put(' ');
+        }
+      });
+    }, bytes});
+
+    list.push_back({"number/"+format.name+"/format/formatDouble", [=]()
+    {
+      return std::function<void()>([=]()
+      {
+        std::stringstream ss;
+        char buffer[32];
+        for(Double x : *values)
+        {
+          ss.write(buffer, String::formatDouble(x, buffer));
+          ss.put(' ');
+        }
+      });
+    }, bytesShortest});
+  }
+
+  // archive I/O
+  // -----------
+  for(std::string extension : {"dat", "txt"})
+  {
+    const FileName fileName = fileNameTmp.appendBaseName(".matrix").replaceFullExtension("."+extension);
+    const UInt rows = (extension == "dat") ? 1000000 : 100000;
+    list.push_back({"archive/"+extension+"/writeMatrix/"+rows%"%ix10"s, [=]()
+    {
+      Matrix A = randomMatrix(rows, 10, *generator);
+      return std::function<void()>([=]() {writeFileMatrix(fileName, A);});
+    }});
+    list.push_back({"archive/"+extension+"/readMatrix/"+rows%"%ix10"s, [=]()
+    {
+      writeFileMatrix(fileName, randomMatrix(rows, 10, *generator));
+      return std::function<void()>([=]() {Matrix A; readFileMatrix(fileName, A);});
+    }});
+  }
+
+  // expression evaluation
+  // ---------------------
+  list.push_back({"expression/parse", [=]()
+  {
+    return std::function<void()>([=]()
+    {
+      VariableList varList;
+      varList.setVariable("x", 2.);
+      for(UInt i=0; i<1000; i++)
+        ExpressionVariable::parse("sqrt(x^2+3*x+1)*sin(deg2rad(x))/(1+exp(-x))", varList);
+    });
+  }});
+
+  list.push_back({"expression/evaluate/100000", [=]()
+  {
+    return std::function<void()>([=]()
+    {
+      VariableList varList;
+      varList.undefineVariable("data0");
+      auto expr = std::make_shared<ExpressionVariable>("value", "sqrt(data0^2+3*data0+1)*sin(deg2rad(data0))/(1+exp(-data0))");
+      expr->simplify(varList);
+      for(UInt i=0; i<100000; i++)
+      {
+        varList.setVariable("data0", 1e-3*i);
+        expr->evaluate(varList);
+      }
+    });
+  }});
+
+  // parallel
+  // --------
+  list.push_back({"parallel/forEachInterval/100000", [=]()
+  {
+    auto sum = std::make_shared<std::vector<Double>>(100000);
+    return std::function<void()>([=]()
+    {
+      Parallel::forEachInterval(sum->size(), {0, sum->size()/2, sum->size()}, [&](UInt i) {sum->at(i) = std::sqrt(i);}, comm, FALSE);
+    });
+  }});
+
+  // GNSS normal accumulation on a synthetic network:
+  // receivers with position, troposphere, and ambiguity parameters,
+  // common satellite parameters, epoch wise receiver clocks eliminated
+  // ------------------------------------------------------------------
+  list.push_back({"gnss/normals/50receivers", [=]()
+  {
+    const UInt receiverCount   = 50;
+    const UInt epochCount      = 100;
+    const UInt obsCount        = 20;  // per receiver and epoch
+    const UInt receiverParam   = 3+12+40;
+    const UInt satelliteParam  = 32*4;
+    std::vector<UInt> blockIndex(1, 0);
+    for(UInt idRecv=0; idRecv<receiverCount; idRecv++)
+      blockIndex.push_back(blockIndex.back()+receiverParam);
+    blockIndex.push_back(blockIndex.back()+satelliteParam);
+    const Matrix Arecv = randomMatrix(obsCount, receiverParam,  *generator);
+    const Matrix Asat  = randomMatrix(obsCount, satelliteParam, *generator);
+    const Matrix l     = randomMatrix(obsCount, 1, *generator);
+
+    return std::function<void()>([=]()
+    {
+      MatrixDistributed normals;
+      normals.initEmpty(blockIndex, Parallel::selfCommunicator());
+      for(UInt i=0; i<normals.blockCount(); i++)
+        for(UInt k=i; k<normals.blockCount(); k++)
+          if((i == k) || (k+1 == normals.blockCount()))
+            normals.setBlock(i, k);
+      const UInt idSat = normals.blockCount()-1;
+      Matrix n(blockIndex.back(), 1);
+      Parallel::forEach(receiverCount, [&](UInt idRecv)
+      {
+        for(UInt idEpoch=0; idEpoch<epochCount; idEpoch++)
+        {
+          Matrix A(obsCount, receiverParam+satelliteParam);
+          copy(Arecv, A.column(0, receiverParam));
+          copy(Asat,  A.column(receiverParam, satelliteParam));
+          Matrix B(obsCount, 1, 1.); // receiver clock
+          Matrix l2 = l;
+          eliminationParameter(B, A, l2);
+          matMult(1., A.column(0, receiverParam).trans(), l2, n.row(normals.blockIndex(idRecv), receiverParam));
+          matMult(1., A.column(receiverParam, satelliteParam).trans(), l2, n.row(normals.blockIndex(idSat), satelliteParam));
+          rankKUpdate(1., A.column(0, receiverParam), normals.N(idRecv, idRecv));
+          matMult(1., A.column(0, receiverParam).trans(), A.column(receiverParam, satelliteParam), normals.N(idRecv, idSat));
+          rankKUpdate(1., A.column(receiverParam, satelliteParam), normals.N(idSat, idSat));
+        }
+      }, Parallel::selfCommunicator(), FALSE);
+    });
+  }});
+
+  return list;
+}
+
+/***********************************************/
+
+static Double seconds(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<Double>(std::chrono::steady_clock::now()-start).count();
+}
+
+/***********************************************/
+
+static BenchmarkResult measure(const Benchmark &benchmark, UInt repeat, Double minTime)
+{
+  auto func = benchmark.init();
+
+  // warm up and number of calls per measurement
+  UInt iterations = 1;
+  for(;;)
+  {
+    auto start = std::chrono::steady_clock::now();
+    for(UInt i=0; i<iterations; i++)
+      func();
+    const Double time = seconds(start);
+    if(time >= minTime)
+      break;
+    iterations = std::max(2*iterations, static_cast<UInt>(std::ceil(1.2*iterations*minTime/std::max(time, 1e-9))));
+  }
+
+  std::vector<Double> times(repeat);
+  for(UInt k=0; k<repeat; k++)
+  {
+    auto start = std::chrono::steady_clock::now();
+    for(UInt i=0; i<iterations; i++)
+      func();
+    times.at(k) = seconds(start)/iterations;
+  }
+  std::sort(times.begin(), times.end());
+
+  BenchmarkResult result;
+  result.name       = benchmark.name;
+  result.iterations = iterations;
+  result.min        = times.front();
+  result.median     = (repeat%2) ? times.at(repeat/2) : 0.5*(times.at(repeat/2-1)+times.at(repeat/2));
+  result.mean       = std::accumulate(times.begin(), times.end(), 0.)/repeat;
+  result.bytes      = benchmark.bytes;
+  return result;
+}
+
+/***********************************************/
+
+static void writeResults(const FileName &fileName, const std::vector<BenchmarkResult> &results, UInt repeat)
+{
+  // one benchmark per line (parsed by readBaseline)
+  OutFile file(fileName);
+  file<<"{\"program\":\"groopsBench\",\"date\":\""<<System::now().dateTimeStr()<<"\",\"repeat\":"<<repeat<<",\"unit\":\"s\",\n";
+  file<<"\"benchmarks\":[";
+  for(UInt i=0; i<results.size(); i++)
+    file<<((i==0) ? "\n" : ",\n")<<"{\"name\":\""<<results.at(i).name<<"\",\"iterations\":"<<results.at(i).iterations
+        <<",\"min\":"<<results.at(i).min%"%.6e"s<<",\"median\":"<<results.at(i).median%"%.6e"s<<",\"mean\":"<<results.at(i).mean%"%.6e"s
+        <<((results.at(i).bytes) ? ",\"MBperSecond\":"+(1e-6*results.at(i).bytes/results.at(i).median)%"%.1f"s : "")<<"}";
+  file<<"]}"<<std::endl;
+}
+
+/***********************************************/
+
+static std::map<std::string, Double> readBaseline(const FileName &fileName)
+{
+  try
+  {
+    auto value = [](const std::string &line, const std::string &key)
+    {
+      const std::string tag = "\""+key+"\":";
+      const auto pos = line.find(tag);
+      if(pos == std::string::npos)
+        throw(Exception("missing element <"+key+">"));
+      return line.substr(pos+tag.size(), line.find_first_of(",}", pos+tag.size())-pos-tag.size());
+    };
+
+    std::map<std::string, Double> median;
+    InFile file(fileName);
+    std::string line;
+    while(std::getline(file, line))
+      if(line.find("\"median\":") != std::string::npos)
+      {
+        std::string name = value(line, "name");
+        median[name.substr(1, name.size()-2)] = String::toDouble(value(line, "median"));
+      }
+    return median;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("filename=<"+fileName.str()+">", e)
+  }
+}
+
+/***********************************************/
+
+static void benchHelp()
+{
+  std::cout<<"GROOPS benchmark suite"<<std::endl;
+  std::cout<<"Usage: groopsBench [--filter <text>] [--repeat <count>] [--min-time <seconds>] [--output <result.json>] [--baseline <baseline.json>] [--tolerance <0.2>] [--list]"<<std::endl;
+  std::cout<<std::endl;
+  std::cout<<" -h, --help           this text"<<std::endl;
+  std::cout<<" -l, --list           list the names of the benchmarks"<<std::endl;
+  std::cout<<" -f, --filter         run only benchmarks containing the text in the name (can be given multiple times)"<<std::endl;
+  std::cout<<" -r, --repeat         number of measurements of each benchmark (default: 5)"<<std::endl;
+  std::cout<<" -t, --min-time       minimum time of a single measurement [s], fast kernels are repeated (default: 0.1)"<<std::endl;
+  std::cout<<" -o, --output         write the results as JSON"<<std::endl;
+  std::cout<<" -b, --baseline       compare the results with a JSON file written before with --output"<<std::endl;
+  std::cout<<" -T, --tolerance      relative increase of the median time marked as regression (default: 0.2)"<<std::endl;
+  exit(EXIT_FAILURE);
+}
+
+/***********************************************/
+
+int main(int argc, char *argv[])
+{
+  Parallel::CommunicatorPtr comm = Parallel::init(argc, argv);
+  Log::init(Parallel::myRank(comm), Parallel::size(comm), Parallel::addChannel(Log::getReceive(), comm));
+
+  UInt regressionCount = 0;
+  try
+  {
+    // handle commandline options
+    // --------------------------
+    std::vector<std::string> filters;
+    FileName fileNameOut, fileNameBaseline;
+    UInt     repeat    = 5;
+    Double   minTime   = 0.1;
+    Double   tolerance = 0.2;
+    Bool     listOnly  = FALSE;
+    for(int i=1; i<argc; i++)
+    {
+      auto optArg = [&]()
+      {
+        if(i+1 >= argc)
+        {
+          std::cout<<"Expected argument for: '"<<argv[i]<<"'"<<std::endl;
+          benchHelp();
+        }
+        return std::string(argv[++i]);
+      };
+
+      const std::string opt(argv[i]);
+      if     ((opt == "-f") || (opt == "--filter"))    {filters.push_back(optArg());}
+      else if((opt == "-r") || (opt == "--repeat"))    {repeat    = std::max(static_cast<UInt>(String::toInt(optArg())), UInt(1));}
+      else if((opt == "-t") || (opt == "--min-time"))  {minTime   = String::toDouble(optArg());}
+      else if((opt == "-o") || (opt == "--output"))    {fileNameOut      = FileName(optArg());}
+      else if((opt == "-b") || (opt == "--baseline"))  {fileNameBaseline = FileName(optArg());}
+      else if((opt == "-T") || (opt == "--tolerance")) {tolerance = String::toDouble(optArg());}
+      else if((opt == "-l") || (opt == "--list"))      {listOnly  = TRUE;}
+      else
+      {
+        if((opt != "-h") && (opt != "--help"))
+          std::cout<<"Unknown option: '"<<opt<<"'"<<std::endl;
+        benchHelp();
+      }
+    }
+
+    const FileName fileNameTmp = System::currentWorkingDirectory().append("groopsBench.tmp");
+    std::vector<Benchmark> benchmarks = benchmarkList(comm, fileNameTmp);
+    if(filters.size())
+      benchmarks.erase(std::remove_if(benchmarks.begin(), benchmarks.end(), [&](const Benchmark &b)
+                       {return std::none_of(filters.begin(), filters.end(), [&](const std::string &f) {return b.name.find(f) != std::string::npos;});}),
+                       benchmarks.end());
+    if(listOnly)
+    {
+      for(auto &benchmark : benchmarks)
+        logInfo<<benchmark.name<<Log::endl;
+      return EXIT_SUCCESS;
+    }
+
+    std::map<std::string, Double> baseline;
+    if(!fileNameBaseline.empty())
+    {
+      logStatus<<"read baseline <"<<fileNameBaseline<<">"<<Log::endl;
+      baseline = readBaseline(fileNameBaseline);
+    }
+
+    // run benchmarks
+    // --------------
+    logStatus<<"=== Starting groopsBench: "<<benchmarks.size()<<" benchmarks ==="<<Log::endl;
+    std::vector<BenchmarkResult> results;
+    for(auto &benchmark : benchmarks)
+    {
+      results.push_back(measure(benchmark, repeat, minTime));
+      const BenchmarkResult &result = results.back();
+      std::string compare;
+      auto iter = baseline.find(result.name);
+      if(iter != baseline.end())
+      {
+        const Double ratio = result.median/iter->second;
+        compare = ratio%"  %6.2fx baseline"s;
+        if(ratio > 1+tolerance)
+        {
+          compare += " (regression)";
+          regressionCount++;
+        }
+      }
+      if(result.bytes)
+        compare = (1e-6*result.bytes/result.median)%" %8.1f MB/s"s+compare;
+      logInfo<<result.name<<std::string(std::max(45, static_cast<int>(result.name.size()))-result.name.size(), ' ')<<result.median*1e3%" %12.4f ms"s<<result.min*1e3%" (min %12.4f ms)"s<<compare<<Log::endl;
+    }
+
+    for(std::string extension : {"dat", "txt"})
+      System::remove(fileNameTmp.appendBaseName(".matrix").replaceFullExtension("."+extension));
+
+    if(!fileNameOut.empty())
+    {
+      logStatus<<"write results to <"<<fileNameOut<<">"<<Log::endl;
+      writeResults(fileNameOut, results, repeat);
+    }
+
+    if(regressionCount)
+      logWarning<<regressionCount<<" regressions against baseline (tolerance "<<100*tolerance<<"%)"<<Log::endl;
+    logStatus<<"=== Finished groopsBench ==="<<Log::endl;
+  }
+  catch(std::exception &e)
+  {
+    logError<<"****** Error ******"<<Log::endl;
+    logError<<e.what()<<Log::endl;
+    return EXIT_FAILURE;
+  }
+
+  return (regressionCount) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/***********************************************/
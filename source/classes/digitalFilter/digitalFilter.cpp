@@ -160,14 +160,7 @@ Matrix DigitalFilterARMA::filter(const_MatrixSliceRef input) const
     if(inFrequencyDomain)
     {
       Matrix padded = pad(input, warmup(), bnStartIndex, padType);
-      auto H = frequencyResponse(padded.rows());
-      for(UInt k=0; k<padded.columns(); k++) // Filter column-wise
-      {
-        auto F = Fourier::fft(padded.column(k));
-        for(UInt i=0; i<F.size(); i++)
-          F.at(i) *= H.at(i);
-        copy(Fourier::synthesis(F, (padded.rows()%2==0)), padded.column(k));
-      }
+      Fourier::filter(padded, frequencyResponse(padded.rows())); // all columns together
       return trim(padded, warmup(), bnStartIndex, padType);
     }
 
@@ -16,6 +16,7 @@
 #include "base/planets.h"
 #include "config/configRegister.h"
 #include "classes/earthRotation/earthRotationFile.h"
+#include "classes/earthRotation/earthRotationInterpolated.h"
 #include "classes/earthRotation/earthRotationIers2010.h"
 #include "classes/earthRotation/earthRotationIers2010b.h"
 #include "classes/earthRotation/earthRotationIers2003.h"
@@ -32,6 +33,7 @@
 
 GROOPS_REGISTER_CLASS(EarthRotation, "earthRotationType",
                       EarthRotationFile,
+                      EarthRotationInterpolated,
                       EarthRotationIers2010,
                       EarthRotationIers2010b,
                       EarthRotationIers2003,
@@ -60,6 +62,8 @@ EarthRotationPtr EarthRotation::create(Config &config, const std::string &name)
 
     if(readConfigChoiceElement(config, "file",     choice, "interpolated values from file"))
       earthRotation = EarthRotationPtr(new EarthRotationFile(config));
+    if(readConfigChoiceElement(config, "interpolated", choice, "tabulated and interpolated Earth orientation parameters"))
+      earthRotation = EarthRotationPtr(new EarthRotationInterpolated(config));
     if(readConfigChoiceElement(config, "iers2010",  choice, "IERS conventions 2010"))
       earthRotation = EarthRotationPtr(new EarthRotationIers2010(config));
     if(readConfigChoiceElement(config, "iers2010b", choice, "IERS conventions 2010 with HF EOP model"))
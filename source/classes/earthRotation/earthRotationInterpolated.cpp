@@ -0,0 +1,123 @@
+/***********************************************/
+/**
+* @file earthRotationInterpolated.cpp
+*
+* @brief Tabulated and interpolated Earth orientation parameters.
+* @see EarthRotation
+*
+* @author agent
+* @date 2026-10-18
+*
+*/
+/***********************************************/
+
+#include "base/import.h"
+#include "config/config.h"
+#include "classes/earthRotation/earthRotation.h"
+#include "classes/earthRotation/earthRotationInterpolated.h"
+
+/***********************************************/
+
+EarthRotationInterpolated::EarthRotationInterpolated(Config &config)
+{
+  try
+  {
+    EarthRotationPtr earthRotation;
+    Time   timeEnd;
+    Double maxError;
+
+    readConfig(config, "earthRotation",       earthRotation,       Config::MUSTSET,  "",    "tabulated Earth rotation model");
+    readConfig(config, "timeStart",           timeStart,           Config::MUSTSET,  "",    "first tabulated epoch");
+    readConfig(config, "timeEnd",             timeEnd,             Config::MUSTSET,  "",    "interval end (last tabulated epoch is at or after timeEnd)");
+    readConfig(config, "sampling",            sampling,            Config::DEFAULT,  "600", "[seconds] sampling of the table");
+    readConfig(config, "interpolationDegree", degree,              Config::DEFAULT,  "7",   "degree of interpolation polynomial");
+    readConfig(config, "maxError",            maxError,            Config::DEFAULT,  "1e-5", "[arcsec] throw exception if the interpolation error exceeds this value");
+    if(isCreateSchema(config)) return;
+
+    if(timeEnd <= timeStart)
+      throw(Exception("timeEnd ("+timeEnd.dateTimeStr()+") must be after timeStart ("+timeStart.dateTimeStr()+")"));
+    if(sampling <= 0)
+      throw(Exception("sampling must be positive"));
+
+    // margin of degree+1 epochs before and after the interval -> centered interpolation everywhere,
+    // also for epochs slightly outside [timeStart, timeEnd] (e.g. integration or interpolation of orbits)
+    const UInt margin = degree+1;
+    const UInt count  = static_cast<UInt>(std::ceil((timeEnd-timeStart).seconds()/sampling)) + 1 + 2*margin;
+    timeStart -= seconds2time(margin*sampling);
+
+    EOP = Matrix(count, 8);
+    for(UInt i=0; i<count; i++)
+    {
+      const Time time = timeStart + seconds2time(i*sampling);
+      earthRotation->earthOrientationParameter(time, EOP(i,0), EOP(i,1), EOP(i,2), EOP(i,3), EOP(i,4), EOP(i,5), EOP(i,6), EOP(i,7));
+      EOP(i,3) -= (time-timeGPS2UTC(time)).seconds(); // UT1-UTC => UT1-GPS (avoid leap seconds jumps for interpolation)
+    }
+
+    // rotation angle between interpolated and directly computed rotation [arcsec]
+    auto rotationError = [&](const Time &time)
+    {
+      const Matrix R = (rotaryMatrix(time) * inverse(earthRotation->rotaryMatrix(time))).matrix();
+      return 0.5*std::sqrt(std::pow(R(1,2)-R(2,1), 2) + std::pow(R(2,0)-R(0,2), 2) + std::pow(R(0,1)-R(1,0), 2)) * RAD2DEG*3600;
+    };
+
+    // models defining the rotation directly (e.g. gmst, era, zAxis, moonRotation, itrf1996)
+    // are not reproduced by the EOPs even at the tabulated epochs
+    for(UInt i : {margin, count-1-margin})
+      if(rotationError(timeStart + seconds2time(i*sampling)) > maxError)
+        throw(Exception("earthRotation is not defined by Earth orientation parameters and cannot be interpolated"));
+
+    // check interpolation error at midpoints
+    // --------------------------------------
+    Double error = 0;
+    for(UInt i=margin; i+margin<count; i++)
+      error = std::max(error, rotationError(timeStart + seconds2time((i+0.5)*sampling)));
+    logInfo<<"Earth rotation tabulated ("<<count<<" epochs), max. interpolation error: "<<error*1e6%"%.3f microarcsec"s<<Log::endl;
+    if(error > maxError)
+      throw(Exception("interpolation error "+(error*1e6)%"%.3f microarcsec exceeds maxError, decrease sampling or increase interpolationDegree"s));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void EarthRotationInterpolated::earthOrientationParameter(const Time &timeGPS, Double &xp, Double &yp, Double &sp,
+                                                          Double &deltaUT, Double &LOD, Double &X, Double &Y, Double &S) const
+{
+  try
+  {
+    // centered Lagrange polynomial on equidistant nodes
+    const Double tau = (timeGPS-timeStart).seconds()/sampling;
+    const Int    idx = static_cast<Int>(std::floor(tau)) - static_cast<Int>(degree/2);
+    if((idx < 0) || (static_cast<UInt>(idx)+degree >= EOP.rows()))
+      throw(Exception(timeGPS.dateTimeStr()+" outside tabulated interval"));
+
+    Double eop[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for(UInt k=0; k<=degree; k++)
+    {
+      Double w = 1.;
+      for(UInt j=0; j<=degree; j++)
+        if(j != k)
+          w *= (tau-idx-j)/(static_cast<Double>(k)-static_cast<Double>(j));
+      for(UInt n=0; n<8; n++)
+        eop[n] += w * EOP(idx+k, n);
+    }
+
+    xp      = eop[0];
+    yp      = eop[1];
+    sp      = eop[2];
+    deltaUT = eop[3] + (timeGPS-timeGPS2UTC(timeGPS)).seconds();
+    LOD     = eop[4];
+    X       = eop[5];
+    Y       = eop[6];
+    S       = eop[7];
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
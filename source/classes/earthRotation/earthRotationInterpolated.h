@@ -0,0 +1,66 @@
+/***********************************************/
+/**
+* @file earthRotationInterpolated.h
+*
+* @brief Tabulated and interpolated Earth orientation parameters.
+* @see EarthRotation
+*
+* @author agent
+* @date 2026-10-18
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_EARTHROTATIONINTERPOLATED__
+#define __GROOPS_EARTHROTATIONINTERPOLATED__
+
+// Latex documentation
+#ifdef DOCSTRING_EarthRotation
+static const char *docstringEarthRotationInterpolated = R"(
+\subsection{Interpolated}\label{earthRotationType:interpolated}
+The Earth orientation parameters (polar motion, UT1, precession/nutation, CIO and TIO locator)
+of \configClass{earthRotation}{earthRotationType} are evaluated once in the interval
+[\config{timeStart}, \config{timeEnd}) with the given \config{sampling}
+and afterwards interpolated with a polynomial of \config{interpolationDegree}.
+As the full IAU 2006/2000A precession-nutation model and the subdaily EOP models
+are expensive this accelerates programs which evaluate the Earth rotation very often
+(e.g. orbit integration, GNSS processing).
+
+The interpolation error is checked at the midpoints of the tabulated intervals
+and reported as the maximum rotation angle between the interpolated and the directly
+computed rotation. If it exceeds \config{maxError} an exception is thrown.
+The table extends \config{interpolationDegree}+1 epochs beyond both interval ends.
+
+Only Earth rotation models defined by Earth orientation parameters can be interpolated.
+Models defining the rotation matrix directly (e.g. gmst, zAxis, moonRotation, itrf1996)
+are rejected with an exception.
+)";
+#endif
+
+/***********************************************/
+
+#include "classes/earthRotation/earthRotation.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Tabulated and interpolated Earth orientation parameters.
+* The table is computed in the constructor and not changed afterwards.
+* All functions are const and can be called concurrently.
+* @ingroup earthRotationGroup
+* @see EarthRotation */
+class EarthRotationInterpolated : public EarthRotation
+{
+  Time   timeStart;
+  Double sampling;
+  UInt   degree;
+  Matrix EOP; // xp, yp, sp, UT1-GPS, LOD, X, Y, S
+
+public:
+  EarthRotationInterpolated(Config &config);
+
+  void earthOrientationParameter(const Time &timeGPS, Double &xp, Double &yp, Double &sp, Double &deltaUT, Double &LOD, Double &X, Double &Y, Double &S) const;
+};
+
+/***********************************************/
+
+#endif /* __GROOPS_EARTHROTATIONINTERPOLATED__ */
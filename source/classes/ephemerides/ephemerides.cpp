@@ -16,12 +16,14 @@
 #include "base/import.h"
 #include "config/configRegister.h"
 #include "classes/ephemerides/ephemeridesJpl.h"
+#include "classes/ephemerides/ephemeridesInterpolated.h"
 #include "classes/ephemerides/ephemerides.h"
 
 /***********************************************/
 
 GROOPS_REGISTER_CLASS(Ephemerides, "ephemeridesType",
-                      EphemeridesJpl)
+                      EphemeridesJpl,
+                      EphemeridesInterpolated)
 
 GROOPS_READCONFIG_CLASS(Ephemerides, "ephemeridesType")
 
@@ -37,6 +39,8 @@ EphemeridesPtr Ephemerides::create(Config &config, const std::string &name)
     readConfigChoice(config, name, type, Config::MUSTSET, "", "ephemerides of Sun, Moon and planets");
     if(readConfigChoiceElement(config, "jpl", type, ""))
       ptr = std::make_shared<EphemeridesJpl>(config);
+    if(readConfigChoiceElement(config, "interpolated", type, "tabulated and interpolated ephemerides"))
+      ptr = std::make_shared<EphemeridesInterpolated>(config);
     endChoice(config);
 
     return ptr;
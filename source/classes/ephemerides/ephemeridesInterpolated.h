@@ -0,0 +1,189 @@
+/***********************************************/
+/**
+* @file ephemeridesInterpolated.h
+*
+* @brief Tabulated and interpolated ephemerides.
+*
+* @author agent
+* @date 2026-10-18
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_EPHEMERIDESINTERPOLATED__
+#define __GROOPS_EPHEMERIDESINTERPOLATED__
+
+// Latex documentation
+#ifdef DOCSTRING_Ephemerides
+static const char *docstringEphemeridesInterpolated = R"(
+\section{Interpolated}\label{ephemeridesType:interpolated}
+Positions and velocities of the selected \config{planet}s are evaluated once from
+\configClass{ephemerides}{ephemeridesType} in the interval [\config{timeStart}, \config{timeEnd})
+with the given \config{sampling} and afterwards interpolated with cubic Hermite polynomials
+(position and velocity at both interval boundaries). If no \config{planet} is given Sun and Moon
+are tabulated. All other planets are forwarded to \configClass{ephemerides}{ephemeridesType}.
+
+The interpolation error is checked at the midpoints of the tabulated intervals and reported.
+If \config{maxError} is set and exceeded an exception is thrown.
+)";
+#endif
+
+/***********************************************/
+
+#include "classes/ephemerides/ephemerides.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Tabulated and interpolated ephemerides.
+* The tables are computed in the constructor and not changed afterwards,
+* evaluation of tabulated planets is thread safe.
+* @ingroup ephemeridesGroup
+* @see Ephemerides */
+class EphemeridesInterpolated : public Ephemerides
+{
+  EphemeridesPtr      ephemerides;
+  Time                timeStart;
+  Double              sampling;
+  std::vector<Matrix> table; // for each planet: Matrix(epochs, 6) with position and velocity
+
+  Bool interpolate(const Time &timeGPS, Planet planet, Vector3d &position, Vector3d &velocity) const;
+
+public:
+  EphemeridesInterpolated(Config &config);
+
+  Vector3d position(const Time &timeGPS, Planet planet) override;
+  void     ephemeris(const Time &timeGPS, Planet planet, Vector3d &position, Vector3d &velocity) override;
+  Planet   origin() const override {return ephemerides->origin();}
+};
+
+/***********************************************/
+
+inline EphemeridesInterpolated::EphemeridesInterpolated(Config &config)
+{
+  try
+  {
+    std::vector<Planet> planets;
+    Time   timeEnd;
+    Double maxError = 0;
+
+    readConfig(config, "ephemerides", ephemerides, Config::MUSTSET,  "",     "tabulated ephemerides");
+    readConfig(config, "planet",      planets,     Config::OPTIONAL, "",     "tabulated planets (default: sun, moon)");
+    readConfig(config, "timeStart",   timeStart,   Config::MUSTSET,  "",     "first tabulated epoch");
+    readConfig(config, "timeEnd",     timeEnd,     Config::MUSTSET,  "",     "interval end (last tabulated epoch is at or after timeEnd)");
+    readConfig(config, "sampling",    sampling,    Config::DEFAULT,  "1800", "[seconds] sampling of the table");
+    readConfig(config, "maxError",    maxError,    Config::OPTIONAL, "",     "[m] throw exception if the interpolation error exceeds this value");
+    if(isCreateSchema(config)) return;
+
+    if(timeEnd <= timeStart)
+      throw(Exception("timeEnd ("+timeEnd.dateTimeStr()+") must be after timeStart ("+timeStart.dateTimeStr()+")"));
+    if(sampling <= 0)
+      throw(Exception("sampling must be positive"));
+    if(!planets.size())
+      planets = {SUN, MOON};
+
+    const UInt count = static_cast<UInt>(std::ceil((timeEnd-timeStart).seconds()/sampling)) + 1;
+    table.resize(EARTHMOONBARYCENTER+1);
+    for(Planet planet : planets)
+    {
+      table.at(planet) = Matrix(count, 6);
+      for(UInt i=0; i<count; i++)
+      {
+        Vector3d pos, vel;
+        ephemerides->ephemeris(timeStart+seconds2time(i*sampling), planet, pos, vel);
+        table.at(planet)(i,0) = pos.x(); table.at(planet)(i,1) = pos.y(); table.at(planet)(i,2) = pos.z();
+        table.at(planet)(i,3) = vel.x(); table.at(planet)(i,4) = vel.y(); table.at(planet)(i,5) = vel.z();
+      }
+    }
+
+    // check interpolation error at midpoints
+    // --------------------------------------
+    Double error = 0;
+    for(Planet planet : planets)
+      for(UInt i=0; i+1<count; i++)
+      {
+        const Time time = timeStart + seconds2time((i+0.5)*sampling);
+        Vector3d pos, vel, posInterpolated, velInterpolated;
+        ephemerides->ephemeris(time, planet, pos, vel);
+        interpolate(time, planet, posInterpolated, velInterpolated);
+        error = std::max(error, (posInterpolated-pos).r());
+      }
+    logInfo<<"Ephemerides tabulated ("<<count<<" epochs), max. interpolation error: "<<error%"%.3e m"s<<Log::endl;
+    if(maxError && (error > maxError))
+      throw(Exception("interpolation error "+error%"%.3e m exceeds maxError, decrease sampling"s));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline Bool EphemeridesInterpolated::interpolate(const Time &timeGPS, Planet planet, Vector3d &position, Vector3d &velocity) const
+{
+  if((static_cast<UInt>(planet) >= table.size()) || !table.at(planet).size())
+    return FALSE;
+  const Matrix &A = table.at(planet);
+
+  const Double tau = (timeGPS-timeStart).seconds()/sampling;
+  if((tau < 0) || (tau > A.rows()-1))
+    throw(Exception(timeGPS.dateTimeStr()+" outside tabulated interval"));
+  const UInt   idx = std::min(static_cast<UInt>(std::floor(tau)), A.rows()-2);
+  const Double t   = tau - idx;
+
+  // cubic Hermite basis functions and derivatives
+  const Double h00 = (1+2*t)*(1-t)*(1-t);
+  const Double h10 = t*(1-t)*(1-t) * sampling;
+  const Double h01 = t*t*(3-2*t);
+  const Double h11 = t*t*(t-1) * sampling;
+  const Double d00 = 6*t*(t-1) / sampling;
+  const Double d10 = (1-t)*(1-3*t);
+  const Double d01 = -d00;
+  const Double d11 = t*(3*t-2);
+
+  Double x[6];
+  for(UInt k=0; k<3; k++)
+  {
+    x[k]   = h00*A(idx,k) + h10*A(idx,k+3) + h01*A(idx+1,k) + h11*A(idx+1,k+3);
+    x[k+3] = d00*A(idx,k) + d10*A(idx,k+3) + d01*A(idx+1,k) + d11*A(idx+1,k+3);
+  }
+  position = Vector3d(x[0], x[1], x[2]);
+  velocity = Vector3d(x[3], x[4], x[5]);
+  return TRUE;
+}
+
+/***********************************************/
+
+inline Vector3d EphemeridesInterpolated::position(const Time &timeGPS, Planet planet)
+{
+  try
+  {
+    Vector3d position, velocity;
+    if(!interpolate(timeGPS, planet, position, velocity))
+      return ephemerides->position(timeGPS, planet);
+    return position;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline void EphemeridesInterpolated::ephemeris(const Time &timeGPS, Planet planet, Vector3d &position, Vector3d &velocity)
+{
+  try
+  {
+    if(!interpolate(timeGPS, planet, position, velocity))
+      ephemerides->ephemeris(timeGPS, planet, position, velocity);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/************************************************/
+
+#endif
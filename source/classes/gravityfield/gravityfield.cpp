@@ -299,6 +299,26 @@ Double Gravityfield::covariance(const Time &time, const Vector3d &point1, const
   return sigma2;
 }
 
+/***********************************************/
+
+Vector Gravityfield::variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel) const
+{
+  Vector d(point.size());
+  for(UInt i=0; i<gravityfield.size(); i++)
+    gravityfield.at(i)->variances(time, point, kernel, d);
+  return d;
+}
+
+/***********************************************/
+
+Vector Gravityfield::covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel) const
+{
+  Vector d(point.size());
+  for(UInt i=0; i<gravityfield.size(); i++)
+    gravityfield.at(i)->covariances(time, point0, point, kernel, d);
+  return d;
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -422,3 +442,138 @@ Double GravityfieldBase::covariance(const Time &time, const Vector3d &point1, co
 }
 
 /***********************************************/
+
+// Default implementation
+void GravityfieldBase::variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  for(UInt i=0; i<point.size(); i++)
+    d(i) += variance(time, point.at(i), kernel);
+}
+
+/***********************************************/
+
+// Default implementation
+void GravityfieldBase::covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  for(UInt i=0; i<point.size(); i++)
+    d(i) += covariance(time, point0, point.at(i), kernel);
+}
+
+/***********************************************/
+
+Matrix GravityfieldBase::covarianceFactor(const Matrix &C)
+{
+  try
+  {
+    // only variances -> standard deviations
+    if(C.getType() != Matrix::SYMMETRIC)
+    {
+      Matrix W = C;
+      for(UInt i=0; i<W.rows(); i++)
+        W(i,0) = std::sqrt(std::max(W(i,0), 0.));
+      return W;
+    }
+
+    std::vector<UInt> index;
+    for(UInt i=0; i<C.rows(); i++)
+      if(C(i,i) > 0)
+        index.push_back(i);
+
+    try
+    {
+      if(index.size() == C.rows())
+      {
+        Matrix W = C;
+        cholesky(W);
+        return W;
+      }
+
+      Matrix N(index.size(), Matrix::SYMMETRIC);
+      for(UInt z=0; z<index.size(); z++)
+        for(UInt s=z; s<index.size(); s++)
+          N(z,s) = C(index.at(z), index.at(s));
+      cholesky(N);
+
+      Matrix W(C.rows(), Matrix::TRIANGULAR);
+      for(UInt z=0; z<index.size(); z++)
+        for(UInt s=z; s<index.size(); s++)
+          W(index.at(z), index.at(s)) = N(z,s);
+      return W;
+    }
+    catch(std::exception &/*e*/)
+    {
+      // not positive definite -> full matrix
+      Matrix W = C;
+      fillSymmetric(W);
+      W.setType(Matrix::GENERAL);
+      return W;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GravityfieldBase::variancesFromFactor(const Matrix &W, const_MatrixSliceRef A, Vector &d)
+{
+  try
+  {
+    if(W.getType() == Matrix::TRIANGULAR)
+    {
+      Matrix B = A.trans();
+      triangularMult(1., W, B); // B = W*A^T
+      for(UInt k=0; k<B.columns(); k++)
+        d(k) += quadsum(B.column(k));
+    }
+    else if(W.columns() == 1) // standard deviations
+    {
+      Matrix B = A;
+      for(UInt i=0; i<B.columns(); i++)
+        B.column(i) *= W(i,0);
+      for(UInt k=0; k<B.rows(); k++)
+        d(k) += quadsum(B.row(k));
+    }
+    else
+    {
+      const Matrix B = A * W;
+      for(UInt k=0; k<B.rows(); k++)
+        d(k) += inner(A.row(k), B.row(k));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GravityfieldBase::covariancesFromFactor(const Matrix &W, const_MatrixSliceRef a0, const_MatrixSliceRef A, Vector &d)
+{
+  try
+  {
+    Vector c = a0.trans();
+    if(W.getType() == Matrix::TRIANGULAR)
+    {
+      triangularMult(1., W, c);
+      c = W.trans() * c;
+    }
+    else if(W.columns() == 1) // standard deviations
+    {
+      for(UInt i=0; i<c.rows(); i++)
+        c(i) *= W(i,0) * W(i,0);
+    }
+    else
+      c = W * c;
+    matMult(1., A, c, d);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -140,6 +140,14 @@ public:
   /** @brief Covariance between gravity field functional at two different points. */
   Double covariance(const Time &time, const Vector3d &point1, const Vector3d &point2, const Kernel &kernel) const;
 
+  /** @brief Variances of gravity field functionals at a list of points.
+  * Same as the diagonal of @a variance(time, point, kernel) but without computing the full matrix.
+  * The points are processed together, large grids should be divided into blocks of some hundred points. */
+  Vector variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel) const;
+
+  /** @brief Covariances between gravity field functional at @a point0 and a list of points. */
+  Vector covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel) const;
+
   /** @brief creates an derived instance of this class. */
   static GravityfieldPtr create(Config &config, const std::string &name) {return GravityfieldPtr(new Gravityfield(config, name));}
 
@@ -189,6 +197,21 @@ public:
   virtual void   variance  (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const=0;
   virtual Double variance  (const Time &time, const Vector3d &point, const Kernel &kernel) const;
   virtual Double covariance(const Time &time, const Vector3d &point1, const Vector3d &point2, const Kernel &kernel) const;
+  virtual void   variances  (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
+  virtual void   covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
+
+protected:
+  /** @brief Factor W of a covariance matrix C for block wise propagation.
+  * A full (SYMMETRIC) covariance matrix is decomposed into an upper TRIANGULAR matrix W with @f$ C = W^TW @f$
+  * (rows and columns with zero variance are excluded). If C is not positive definite,
+  * the full (GENERAL) matrix C is returned. A vector of variances is converted to standard deviations. */
+  static Matrix covarianceFactor(const Matrix &C);
+
+  /** @brief Diagonal of A*C*A^T: @a d += diag(A*C*A^T) with @a W = covarianceFactor(C). */
+  static void variancesFromFactor(const Matrix &W, const_MatrixSliceRef A, Vector &d);
+
+  /** @brief Covariances with a single point: @a d += A*C*a0^T with @a W = covarianceFactor(C). */
+  static void covariancesFromFactor(const Matrix &W, const_MatrixSliceRef a0, const_MatrixSliceRef A, Vector &d);
 };
 
 /***********************************************/
@@ -158,13 +158,44 @@ void GravityfieldFromParametrization::deformation(const std::vector<Time> &time,
 
 /***********************************************/
 
-void GravityfieldFromParametrization::variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const
+Matrix GravityfieldFromParametrization::designMatrix(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel) const
 {
   try
   {
     Matrix A(point.size(), parametrization->parameterCount());
     for(UInt i=0; i<point.size(); i++)
       parametrization->field(time, point.at(i), kernel, A.row(i));
+    return A;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+const Matrix &GravityfieldFromParametrization::covarianceFactor() const
+{
+  try
+  {
+    if(!W.size())
+      W = GravityfieldBase::covarianceFactor(C.size() ? C : Matrix(sigma2x));
+    return W;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GravityfieldFromParametrization::variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const
+{
+  try
+  {
+    Matrix A = designMatrix(time, point, kernel);
     if(C.size())
       D += A*C*A.trans();
     else
@@ -180,6 +211,36 @@ void GravityfieldFromParametrization::variance(const Time &time, const std::vect
   }
 }
 
+/***********************************************/
+
+void GravityfieldFromParametrization::variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    if(sigma2x.size())
+      variancesFromFactor(covarianceFactor(), designMatrix(time, point, kernel), d);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GravityfieldFromParametrization::covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    if(sigma2x.size())
+      covariancesFromFactor(covarianceFactor(), designMatrix(time, {point0}, kernel), designMatrix(time, point, kernel), d);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 
 /***********************************************/
 
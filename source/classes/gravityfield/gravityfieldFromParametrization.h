@@ -50,6 +50,10 @@ class GravityfieldFromParametrization : public GravityfieldBase
   Double  factor;
   Matrix  C; // full covariance matrix
   Vector  sigma2x;
+  mutable Matrix W; // covariance factor (computed on demand)
+
+  Matrix designMatrix(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel) const;
+  const Matrix &covarianceFactor() const;
 
 public:
   GravityfieldFromParametrization(Config &config);
@@ -63,7 +67,9 @@ public:
   void     deformation    (const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
                            const Vector &hn, const Vector &ln, std::vector<std::vector<Vector3d>> &disp) const override;
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const override;
-  void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const override;
+  void variance   (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const override;
+  void variances  (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const override;
+  void covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const override;
 };
 
 /***********************************************/
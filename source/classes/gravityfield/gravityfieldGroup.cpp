@@ -97,6 +97,20 @@ void GravityfieldGroup::variance(const Time &time, const std::vector<Vector3d> &
 
 /***********************************************/
 
+void GravityfieldGroup::variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  axpy(factor*factor, gravityfield->variances(time, point, kernel), d);
+}
+
+/***********************************************/
+
+void GravityfieldGroup::covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  axpy(factor*factor, gravityfield->covariances(time, point0, point, kernel), d);
+}
+
+/***********************************************/
+
 SphericalHarmonics GravityfieldGroup::sphericalHarmonics(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const
 {
   return factor * gravityfield->sphericalHarmonics(time, maxDegree, minDegree, GM, R);
@@ -50,7 +50,9 @@ public:
 
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const;
 
-  void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
+  void variance   (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
+  void variances  (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
+  void covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
 };
 
 /***********************************************/
@@ -177,3 +177,33 @@ void GravityfieldInInterval::variance(const Time &time, const std::vector<Vector
 }
 
 /***********************************************/
+
+void GravityfieldInInterval::variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    if(time.isInInterval(timeStart, timeEnd))
+      d += gravityfield->variances(time, point, kernel);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GravityfieldInInterval::covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    if(time.isInInterval(timeStart, timeEnd))
+      d += gravityfield->covariances(time, point0, point, kernel);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -54,7 +54,9 @@ public:
   void     deformation    (const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
                            const Vector &hn, const Vector &ln, std::vector<std::vector<Vector3d>> &disp) const;
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const;
-  void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
+  void variance   (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
+  void variances  (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
+  void covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
 };
 
 /***********************************************/
@@ -117,7 +117,7 @@ void GravityfieldOscillation::deformation(const std::vector<Time> &time, const s
   std::vector<std::vector<Vector3d>> dispSin(point.size());
   for(UInt k=0; k<point.size(); k++)
     dispSin.at(k).resize(time.size());
-  gravityfieldCos->deformation(time, point, gravity, hn, ln, dispSin);
+  gravityfieldSin->deformation(time, point, gravity, hn, ln, dispSin);
 
   for(UInt i=0; i<time.size(); i++)
   {
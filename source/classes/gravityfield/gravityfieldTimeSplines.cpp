@@ -27,15 +27,17 @@ GravityfieldTimeSplines::GravityfieldTimeSplines(Config &config)
   {
     maxDegree = INFINITYDEGREE;
     FileName fileName, covName;
+    UInt     nodeCountInMemory;
 
     readConfig(config, "inputfileTimeSplinesGravityfield", fileName,  Config::MUSTSET,  "{groopsDataDir}/", "");
     readConfig(config, "inputfileTimeSplinesCovariance",   covName,   Config::OPTIONAL, "",    "");
     readConfig(config, "minDegree",                        minDegree, Config::DEFAULT,  "0",   "");
     readConfig(config, "maxDegree",                        maxDegree, Config::OPTIONAL, "",    "");
     readConfig(config, "factor",                           factor,    Config::DEFAULT,  "1.0", "the result is multiplied by this factor, set -1 to subtract the field");
+    readConfig(config, "nodeCountInMemory",                nodeCountInMemory, Config::DEFAULT, "0", "max. number of spline nodes kept in memory (0: spline support only)");
     if(isCreateSchema(config)) return;
 
-    splinesFile.open(fileName, maxDegree, minDegree);
+    splinesFile.open(fileName, maxDegree, minDegree, nodeCountInMemory);
     hasCovariance = !covName.empty();
     if(hasCovariance)
       covarianceFile.open(covName, maxDegree, minDegree);
@@ -95,26 +97,66 @@ Vector3d GravityfieldTimeSplines::deformation(const Time &time, const Vector3d &
 void GravityfieldTimeSplines::deformation(const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
                                           const Vector &hn, const Vector &ln, std::vector<std::vector<Vector3d>> &disp) const
 {
-  if((time.size()==0) || (point.size()==0))
-    return;
-
-  Matrix A;
-  for(UInt i=0; i<time.size(); i++)
+  try
   {
-    SphericalHarmonics harm = splinesFile.sphericalHarmonics(time.at(i), factor);
-    Vector anm = harm.x();
-
-    if(A.columns() < anm.rows())
-      A = deformationMatrix(point, gravity, hn, ln, harm.GM(), harm.R(), harm.maxDegree());
+    if((time.size()==0) || (point.size()==0))
+      return;
 
-    Vector x = A.column(0, anm.rows())*anm;
-    for(UInt k=0; k<point.size(); k++)
+    // spline support of all epochs
+    std::vector<UInt>   index(time.size());
+    std::vector<Vector> coeff(time.size());
+    std::vector<UInt>   nodes;
+    for(UInt i=0; i<time.size(); i++)
     {
-      disp.at(k).at(i).x() += x(3*k+0);
-      disp.at(k).at(i).y() += x(3*k+1);
-      disp.at(k).at(i).z() += x(3*k+2);
+      index.at(i) = splinesFile.interval(time.at(i), coeff.at(i));
+      for(UInt k=0; k<coeff.at(i).rows(); k++)
+        nodes.push_back(index.at(i)+k);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+    // displacements at nodal points: station design computed once,
+    // applied as matrix product to blocks of nodal points
+    constexpr UInt blockSize = 64;
+    Matrix A;
+    for(UInt idBlock=0; idBlock<nodes.size(); idBlock+=blockSize)
+    {
+      const UInt count = std::min(blockSize, nodes.size()-idBlock);
+      Matrix X;
+      for(UInt k=0; k<count; k++)
+      {
+        SphericalHarmonics harm = splinesFile.sphericalHarmonics(nodes.at(idBlock+k));
+        if(!A.size())
+          A = deformationMatrix(point, gravity, hn, ln, harm.GM(), harm.R(), harm.maxDegree());
+        if(!X.size())
+          X = Matrix(A.columns(), count);
+        const Vector x = harm.x();
+        copy(x.row(0, std::min(x.rows(), X.rows())), X.slice(0, k, std::min(x.rows(), X.rows()), 1));
+      }
+      const Matrix D = A * X;
+
+      // spline interpolation of the displacements
+      for(UInt i=0; i<time.size(); i++)
+        for(UInt k=0; k<coeff.at(i).rows(); k++)
+        {
+          const UInt idNode = index.at(i)+k;
+          if((idNode < nodes.at(idBlock)) || (idNode > nodes.at(idBlock+count-1)))
+            continue;
+          const UInt   idx = std::distance(nodes.begin(), std::lower_bound(nodes.begin()+idBlock, nodes.begin()+idBlock+count, idNode)) - idBlock;
+          const Double w   = factor * coeff.at(i)(k);
+          for(UInt p=0; p<point.size(); p++)
+          {
+            disp.at(p).at(i).x() += w * D(3*p+0, idx);
+            disp.at(p).at(i).y() += w * D(3*p+1, idx);
+            disp.at(p).at(i).z() += w * D(3*p+2, idx);
+          }
+        }
     }
   }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
 }
 
 /***********************************************/
@@ -182,20 +224,16 @@ Matrix GravityfieldTimeSplines::sphericalHarmonicsCovariance(const Time &time, U
 
 /***********************************************/
 
-void GravityfieldTimeSplines::variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const
+Matrix GravityfieldTimeSplines::designMatrix(const std::vector<Vector3d> &point, const Kernel &kernel, UInt columns) const
 {
   try
   {
-    if((!hasCovariance) || (time==Time()))
-      return;
-
-    Double GM        = covarianceFile.GM();
-    Double R         = covarianceFile.R();
-    Matrix C         = covarianceFile.covariance(time, 1.);
-    UInt   maxDegree = covarianceFile.maxDegree();
+    const Double GM        = covarianceFile.GM();
+    const Double R         = covarianceFile.R();
+    const UInt   maxDegree = covarianceFile.maxDegree();
 
     // A = linear function from spherical harmonics to point values
-    Matrix A(point.size(), C.rows());
+    Matrix A(point.size(), columns);
     for(UInt k=0; k<point.size(); k++)
     {
       Matrix Cnm, Snm;
@@ -212,6 +250,44 @@ void GravityfieldTimeSplines::variance(const Time &time, const std::vector<Vecto
         }
       }
     }
+    return A;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+const Matrix &GravityfieldTimeSplines::covarianceFactor(const Time &time) const
+{
+  try
+  {
+    if(time != timeFactor)
+    {
+      W = GravityfieldBase::covarianceFactor(covarianceFile.covariance(time, 1.));
+      timeFactor = time;
+    }
+    return W;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GravityfieldTimeSplines::variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const
+{
+  try
+  {
+    if((!hasCovariance) || (time==Time()))
+      return;
+
+    Matrix C = covarianceFile.covariance(time, 1.);
+    Matrix A = designMatrix(point, kernel, C.rows());
 
     if(C.getType() == Matrix::SYMMETRIC) // full covariance matrix?
       D += A * C * A.trans();
@@ -229,3 +305,39 @@ void GravityfieldTimeSplines::variance(const Time &time, const std::vector<Vecto
 }
 
 /***********************************************/
+
+void GravityfieldTimeSplines::variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    if((!hasCovariance) || (time==Time()))
+      return;
+
+    const Matrix &W = covarianceFactor(time);
+    variancesFromFactor(W, designMatrix(point, kernel, W.rows()), d);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GravityfieldTimeSplines::covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    if((!hasCovariance) || (time==Time()))
+      return;
+
+    const Matrix &W = covarianceFactor(time);
+    covariancesFromFactor(W, designMatrix({point0}, kernel, W.rows()), designMatrix(point, kernel, W.rows()), d);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
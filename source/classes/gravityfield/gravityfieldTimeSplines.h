@@ -28,6 +28,10 @@ This file can be created for example by \program{Gravityfield2TimeSplines} or
 \program{PotentialCoefficients2BlockMeanTimeSplines}.
 
 The computed result is multiplied with \config{factor}.
+
+The spline nodes are read from file on demand. At most \config{nodeCountInMemory} nodes
+(at least the spline support) are kept in memory, the least recently used are dropped first.
+Larger values avoid rereading if the field is evaluated at unordered times.
 )";
 #endif
 
@@ -49,6 +53,11 @@ class GravityfieldTimeSplines : public GravityfieldBase
   UInt    maxDegree;
   mutable InFileTimeSplinesGravityfield splinesFile;
   mutable InFileTimeSplinesCovariance   covarianceFile;
+  mutable Time   timeFactor; // time of covariance factor W
+  mutable Matrix W;
+
+  Matrix designMatrix(const std::vector<Vector3d> &point, const Kernel &kernel, UInt columns) const;
+  const Matrix &covarianceFactor(const Time &time) const;
 
 public:
   GravityfieldTimeSplines(Config &config);
@@ -67,7 +76,9 @@ public:
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, Double GM=0.0, Double R=0.0) const;
   Matrix sphericalHarmonicsCovariance  (const Time &time, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, Double GM=0.0, Double R=0.0) const;
 
-  void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
+  void variance   (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
+  void variances  (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
+  void covariances(const Time &time, const Vector3d &point0, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
 };
 
 /***********************************************/
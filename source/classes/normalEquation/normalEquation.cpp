@@ -64,7 +64,9 @@ NormalEquation::NormalEquation(Config &config, const std::string &name)
         return;
     };
 
-    status = UNKNOWN;
+    status             = UNKNOWN;
+    monteCarloAccuracy = 0;
+    monteCarloMaxCount = 100;
   }
   catch(std::exception &e)
   {
@@ -98,6 +100,9 @@ void NormalEquation::init(UInt blockSize, Parallel::CommunicatorPtr comm)
     obsCount = 0;
     x        = Matrix(paraCount, rhsCount);
     Wz       = Matrix(paraCount, 100);
+    isWzOutdated       = FALSE;
+    forceDecomposition = FALSE;
+    redundancyError    = 0;
 
     // init normals components
     for(auto component : normalsComponent)
@@ -151,6 +156,14 @@ Vector NormalEquation::varianceComponentFactors() const
 
 /***********************************************/
 
+void NormalEquation::setMonteCarloAccuracy(Double accuracy, UInt maxCount)
+{
+  monteCarloAccuracy = accuracy;
+  monteCarloMaxCount = std::max(maxCount, UInt(2));
+}
+
+/***********************************************/
+
 void NormalEquation::setApproximateSolution(const const_MatrixSlice &x0)
 {
   try
@@ -189,11 +202,32 @@ Bool NormalEquation::build(UInt rightHandSide)
     obsCount = 0;
 
     Bool ready = TRUE;
+    redundancyError = 0;
     for(auto component : normalsComponent)
+    {
       ready = component->addNormalEquation(rhsNo, x, Wz, normals, n, lPl, obsCount) && ready;
+      redundancyError = std::max(redundancyError, component->redundancyError());
+    }
+    Parallel::broadCast(redundancyError, 0, normals.communicator());
 
     status = NORMAL;
-    return ready || (varianceComponentFactors().rows() == 1); // if only one sigma -> iteration is not needed
+    if(varianceComponentFactors().rows() == 1) // if only one sigma -> iteration is not needed
+      return TRUE;
+    // converged factors estimated with redundancies of a reused decomposition
+    // -> one more iteration with a new decomposition
+    if(ready && isWzOutdated)
+    {
+      forceDecomposition = TRUE;
+      return FALSE;
+    }
+    // redundancies not accurate enough -> one more iteration with more samples
+    if(ready && (monteCarloAccuracy > 0) && (redundancyError > monteCarloAccuracy) && (Wz.columns() < monteCarloMaxCount))
+    {
+      logInfo<<"  relative accuracy of the redundancies "<<redundancyError<<" -> more Monte-Carlo samples"<<Log::endl;
+      forceDecomposition = TRUE;
+      return FALSE;
+    }
+    return ready;
   }
   catch(std::exception &e)
   {
@@ -221,7 +255,7 @@ void NormalEquation::write(const FileName &fileName)
 
 /***********************************************/
 
-Matrix NormalEquation::solve()
+Matrix NormalEquation::solve(Double maxFactorChange)
 {
   try
   {
@@ -241,13 +275,58 @@ Matrix NormalEquation::solve()
           }
       }
 
+    // reuse previous decomposition?
+    const Vector factors = varianceComponentFactors();
+    UInt reuse = (maxFactorChange > 0) && !forceDecomposition && choleskyPrevious.blockCount() && (factorsPrevious.rows() == factors.rows());
+    for(UInt i=0; reuse && (i<factors.rows()); i++)
+      reuse = (std::fabs(factors(i)/factorsPrevious(i)-1.) <= maxFactorChange);
+    Parallel::broadCast(reuse, 0, normals.communicator());
+    if(reuse)
+    {
+      UInt iterCount;
+      if(solveConjugateGradient(100, 1e-10, iterCount))
+      {
+        logInfo<<"  previous cholesky decomposition reused as preconditioner ("<<iterCount<<" iterations)"<<Log::endl;
+        isWzOutdated = TRUE;
+        return x;
+      }
+      logWarning<<"conjugate gradients not converged after "<<iterCount-1<<" iterations -> new cholesky decomposition"<<Log::endl;
+    }
+
     x = normals.solve(n, TRUE/*timing*/);
     Parallel::broadCast(x, 0, normals.communicator());
 
+    // number of samples from the accuracy of the last estimated redundancies
+    UInt sampleCount = Wz.columns();
+    if((monteCarloAccuracy > 0) && (redundancyError > 0))
+    {
+      constexpr UInt minCount = 10;
+      sampleCount = static_cast<UInt>(std::ceil(sampleCount * std::pow(redundancyError/monteCarloAccuracy, 2)));
+      sampleCount = std::min(std::max(sampleCount, minCount), monteCarloMaxCount);
+    }
+    Parallel::broadCast(sampleCount, 0, normals.communicator());
+
     // N contains now the cholesky decomposition
-    Wz = Vce::monteCarlo(x.rows(), 100);
-    normals.triangularSolve(Wz);
+    // samples are generated at the process of the diagonal block and solved distributed
+    std::vector<Matrix> WzBlock(normals.blockCount());
+    for(UInt i=0; i<normals.blockCount(); i++)
+      WzBlock.at(i) = normals.isMyRank(i,i) ? Vce::monteCarlo(normals.blockSize(i), sampleCount) : Matrix(normals.blockSize(i), sampleCount);
+    normals.triangularSolve(WzBlock);
+    Wz = Matrix(x.rows(), sampleCount);
+    if(Parallel::isMaster(normals.communicator()))
+      for(UInt i=0; i<normals.blockCount(); i++)
+        copy(WzBlock.at(i), Wz.row(normals.blockIndex(i), normals.blockSize(i)));
     Parallel::broadCast(Wz, 0, normals.communicator());
+    if(monteCarloAccuracy > 0)
+      logInfo<<"  "<<sampleCount<<" Monte-Carlo samples for the redundancies"<<Log::endl;
+    isWzOutdated       = FALSE;
+    forceDecomposition = FALSE;
+
+    if(maxFactorChange > 0) // copy on write: memory is copied with the next build
+    {
+      choleskyPrevious = normals;
+      factorsPrevious  = factors;
+    }
 
     status = CHOLESKY;
     return x;
@@ -260,6 +339,101 @@ Matrix NormalEquation::solve()
 
 /***********************************************/
 
+Bool NormalEquation::solveConjugateGradient(UInt maxIter, Double tolerance, UInt &iterCount)
+{
+  try
+  {
+    Parallel::CommunicatorPtr comm = normals.communicator();
+
+    // N * p (p at all processes, result at master)
+    auto multiply = [&](const_MatrixSliceRef p)
+    {
+      Matrix Np(p.rows(), p.columns());
+      for(UInt i=0; i<normals.blockCount(); i++)
+        for(UInt k=i; k<normals.blockCount(); k++)
+          if(normals.isMyRank(i, k))
+          {
+            matMult(1., normals.N(i,k), p.row(normals.blockIndex(k), normals.blockSize(k)), Np.row(normals.blockIndex(i), normals.blockSize(i)));
+            if(i != k)
+              matMult(1., normals.N(i,k).trans(), p.row(normals.blockIndex(i), normals.blockSize(i)), Np.row(normals.blockIndex(k), normals.blockSize(k)));
+          }
+      Parallel::reduceSum(Np, 0, comm);
+      return Np;
+    };
+
+    // (W^T W)^-1 * r with previous decomposition (at master)
+    auto precondition = [&](Matrix r)
+    {
+      choleskyPrevious.triangularTransSolve(r);
+      choleskyPrevious.triangularSolve(r);
+      return r;
+    };
+
+    // start with solution of the previous iteration
+    Matrix r = multiply(x);
+    if(Parallel::isMaster(comm))
+      r = n - r;
+    Matrix z = precondition(r);
+    Matrix p = z;
+    Vector rz(n.columns()), nNorm(n.columns());
+    if(Parallel::isMaster(comm))
+      for(UInt k=0; k<n.columns(); k++)
+      {
+        rz(k)    = inner(r.column(k), z.column(k));
+        nNorm(k) = norm(n.column(k));
+      }
+
+    UInt converged = FALSE, breakdown = FALSE;
+    for(iterCount=1; iterCount<=maxIter; iterCount++)
+    {
+      Parallel::broadCast(p, 0, comm);
+      const Matrix q = multiply(p);
+      if(Parallel::isMaster(comm))
+      {
+        converged = TRUE;
+        for(UInt k=0; k<n.columns(); k++)
+        {
+          const Double pq = inner(p.column(k), q.column(k));
+          if(pq <= 0) // no further descent possible
+          {
+            if(norm(r.column(k)) > tolerance*nNorm(k))
+              breakdown = TRUE;
+            continue;
+          }
+          const Double alpha = rz(k)/pq;
+          axpy( alpha, p.column(k), x.column(k));
+          axpy(-alpha, q.column(k), r.column(k));
+          if(norm(r.column(k)) > tolerance*nNorm(k))
+            converged = FALSE;
+        }
+      }
+      Parallel::broadCast(converged, 0, comm);
+      Parallel::broadCast(breakdown, 0, comm);
+      if(converged || breakdown)
+        break;
+
+      z = precondition(r);
+      if(Parallel::isMaster(comm))
+        for(UInt k=0; k<n.columns(); k++)
+        {
+          const Double rzOld = rz(k);
+          rz(k) = inner(r.column(k), z.column(k));
+          p.column(k) *= (rzOld > 0) ? rz(k)/rzOld : 0.;
+          p.column(k) += z.column(k);
+        }
+    }
+
+    Parallel::broadCast(x, 0, comm);
+    return converged && !breakdown;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Double NormalEquation::aposterioriSigma()
 {
   try
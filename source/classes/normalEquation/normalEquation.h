@@ -92,9 +92,18 @@ private:
   UInt              obsCount;
   Matrix            Wz;       // Monte-Carlo-vector
   Matrix            x;        // current solution
+  MatrixDistributed choleskyPrevious; // decomposition of a previous iteration (to be reused)
+  Vector            factorsPrevious;  // variance factors of choleskyPrevious
+  Bool              isWzOutdated;       // Wz belongs to a previous decomposition (reused as preconditioner)
+  Bool              forceDecomposition; // next solve() must compute a new decomposition
+  Double            monteCarloAccuracy; // target relative standard deviation of the estimated redundancies (0: fixed sample count)
+  UInt              monteCarloMaxCount; // maximum number of Monte-Carlo samples
+  Double            redundancyError;    // relative standard deviation of the redundancies of the last build
 
   std::vector<NormalEquationBase*> normalsComponent;
 
+  Bool solveConjugateGradient(UInt maxIter, Double tolerance, UInt &iterCount);
+
 public:
   /// Constructor.
   NormalEquation(Config &config, const std::string &name);
@@ -126,6 +135,14 @@ public:
   * Estimated with Variance Component Estimation (VCE). */
   Vector varianceComponentFactors() const;
 
+  /** @brief Adaptive Monte-Carlo trace estimation of the redundancies.
+  * The redundancies of the variance components are estimated with Monte-Carlo-vectors (Hutchinson estimator).
+  * With each new decomposition the number of samples is chosen from the standard deviation of the redundancies
+  * of the last iteration such that their relative standard deviation reaches @p accuracy, but at most @p maxCount.
+  * If the variance factors converge before this accuracy is reached, @a build returns FALSE once more.
+  * @p accuracy = 0 keeps a fixed number of 100 samples. */
+  void setMonteCarloAccuracy(Double accuracy, UInt maxCount);
+
   /** @brief Set approximate solution.
   * To speed up the iterative Variance Component Estimation (VCE). */
   void setApproximateSolution(const const_MatrixSlice &x0);
@@ -150,9 +167,15 @@ public:
   void write(const FileName &name);
 
   /** @brief Solve the system of normal equations.
-  * Change of state of this class: (NORMAL -> CHOLESKY).
+  * If @p maxFactorChange > 0 and all variance factors changed relatively by less than @p maxFactorChange
+  * since the last Cholesky decomposition, this decomposition is reused as preconditioner
+  * for conjugate gradients instead of a new decomposition. The Monte-Carlo-vectors
+  * for the trace estimation of the next iteration are kept in this case.
+  * If the variance factors converge with such outdated Monte-Carlo-vectors, @a build returns FALSE once more
+  * and the next call computes a new decomposition, so the final variance factors are based on correct redundancies.
+  * Change of state of this class: (NORMAL -> CHOLESKY) or (NORMAL -> NORMAL) if the decomposition is reused.
   * @return Solution vector as columns of the matrix. */
-  Matrix solve();
+  Matrix solve(Double maxFactorChange=0.);
 
   /** @brief A posteriori sigma.
   * Change of state of this class: (CHOLESKY -> CHOLESKY). */
@@ -214,6 +237,7 @@ protected:
                                    MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount) = 0;
   virtual Vector contribution(MatrixDistributed &Cov) = 0;
   virtual std::vector<Double> varianceComponentFactors() const = 0;
+  virtual Double redundancyError() const {return 0.;} // relative standard deviation of the Monte-Carlo estimated redundancy (at master)
 
   friend class NormalEquation;
 };
@@ -15,7 +15,9 @@
 
 #include "base/import.h"
 #include "config/config.h"
+#include "inputOutput/profiler.h"
 #include "parallel/parallel.h"
+#include "misc/varianceComponentEstimation.h"
 #include "files/fileArcList.h"
 #include "classes/observation/observation.h"
 #include "classes/normalEquation/normalEquation.h"
@@ -47,6 +49,7 @@ NormalEquationDesign::NormalEquationDesign(Config &config)
 
     sigma2   *= sigma2;
     sigma2New = sigma2;
+    redundancyAccuracy = 0;
   }
   catch(std::exception &e)
   {
@@ -114,6 +117,7 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
     obsCount = 0;
     Double      ePe        = 0;
     Double      redundancy = 0;
+    Vector      traceColumns(Wz.columns()); // Monte-Carlo samples of trace(A'A*N^(-1))
     MatrixSlice x0(x.slice(startIndex, rhsNo, observation->parameterCount(), 1));
     MatrixSlice Wz0(Wz.row(startIndex, observation->parameterCount()));
 
@@ -122,7 +126,10 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
     {
       // observation equations
       Matrix l, A, B;
-      observation->observation(arcNo, l, A, B);
+      {
+        Profiler::Scope scope(typeid(*observation));
+        observation->observation(arcNo, l, A, B);
+      }
       if(l.rows()==0)
         return;
 
@@ -144,9 +151,14 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
       matMult(1/sigma2, A.trans(), l, n);
       for(UInt i=0; i<l.columns(); i++)
         lPl(i) += quadsum(l.column(i)) + quadsum(l2.column(i))/sigma2;
+      Vector e = l.column(rhsNo); // residuals
+      matMult(-1., A, x0, e);
       obsCount   += l.rows() + l2.rows();
-      ePe        += (quadsum(l.column(rhsNo) - A*x0) + quadsum(l2.column(rhsNo)))/sigma2;
-      redundancy += l.rows() - quadsum(A*Wz0)/sigma2;
+      ePe        += (quadsum(e) + quadsum(l2.column(rhsNo)))/sigma2;
+      redundancy += l.rows();
+      const Matrix AWz = A*Wz0;
+      for(UInt k=0; k<AWz.columns(); k++)
+        traceColumns(k) += quadsum(AWz.column(k))/sigma2;
 
       // accumulate normals
       // ------------------
@@ -176,6 +188,9 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
     {
       Parallel::reduceSum(ePe,        0, normals.communicator());
       Parallel::reduceSum(redundancy, 0, normals.communicator());
+      Parallel::reduceSum(traceColumns, 0, normals.communicator());
+      redundancy -= sum(traceColumns);
+      redundancyAccuracy = Vce::monteCarloStandardDeviation(traceColumns)/redundancy;
       sigma2New = ePe/redundancy;
       ready = (std::fabs(sqrt(sigma2New)-std::sqrt(sigma2))/std::sqrt(sigma2New) < 0.01);
       Parallel::broadCast(sigma2New, 0, normals.communicator());
@@ -54,6 +54,7 @@ class NormalEquationDesign : public NormalEquationBase
   std::vector<UInt> intervals;
   ObservationPtr    observation;
   Double            sigma2, sigma2New;
+  Double            redundancyAccuracy; // relative standard deviation of the Monte-Carlo estimated redundancy
 
 public:
   NormalEquationDesign(Config &config);
@@ -66,6 +67,7 @@ public:
                            MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount) override;
   Vector contribution(MatrixDistributed &Cov) override;
   std::vector<Double> varianceComponentFactors() const override {return std::vector<Double>({sigma2});}
+  Double redundancyError() const override {return redundancyAccuracy;}
 };
 
 /***********************************************/
@@ -16,7 +16,9 @@
 
 #include "base/import.h"
 #include "config/config.h"
+#include "inputOutput/profiler.h"
 #include "parallel/parallel.h"
+#include "misc/varianceComponentEstimation.h"
 #include "files/fileArcList.h"
 #include "classes/observation/observation.h"
 #include "classes/normalEquation/normalEquation.h"
@@ -46,6 +48,7 @@ NormalEquationDesignVCE::NormalEquationDesignVCE(Config &config)
 
     iter     = 0;
     sigma2.resize(observation->arcCount(), 1.0);
+    redundancyAccuracy = 0;
   }
   catch(std::exception &e)
   {
@@ -111,12 +114,17 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
     logStatus<<"accumulate normals from observation equations"<<Log::endl;
     Vector x0  = x.slice(startIndex, rhsNo, observation->parameterCount(), 1);
     Matrix Wz0 = Wz.row(startIndex, observation->parameterCount());
+    Double redundancy = 0;
+    Vector traceColumns(Wz.columns()); // Monte-Carlo samples of trace(A'A*N^(-1)) of all arcs
 
     Parallel::forEachInterval(sigma2, intervals, [&](UInt arcNo) -> Double
     {
       // observation equations
       Matrix l, A, B;
-      observation->observation(arcNo, l, A, B);
+      {
+        Profiler::Scope scope(typeid(*observation));
+        observation->observation(arcNo, l, A, B);
+      }
       if(l.rows()==0)
         return 0;
 
@@ -136,8 +144,16 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
       // Partial redundancy
       // trace(A'A*N^(-1)) = trace(A'A*W^(-1)*W^(-T))
       //                   = z'*W^(-1)*A'*A*W^(-T)*z (MonteCarlo trace estimation)
-      const Double r      = l.rows() + l2.rows() - quadsum(A*Wz0)/sigma2.at(arcNo);
-      const Double sigma2 = (quadsum(l.column(rhsNo)-A*x0) + quadsum(l2.column(rhsNo)))/r;
+      const Matrix AWz = A*Wz0;
+      Vector trace(AWz.columns());
+      for(UInt k=0; k<AWz.columns(); k++)
+        trace(k) = quadsum(AWz.column(k))/sigma2.at(arcNo);
+      const Double r      = l.rows() + l2.rows() - sum(trace);
+      redundancy   += r;
+      traceColumns += trace;
+      Vector e = l.column(rhsNo); // residuals
+      matMult(-1., A, x0, e);
+      const Double sigma2 = (quadsum(e) + quadsum(l2.column(rhsNo)))/r;
 
       // right hand side
       // ---------------
@@ -171,6 +187,10 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
     Parallel::reduceSum(lPl,      0, normals.communicator());
     Parallel::reduceSum(obsCount, 0, normals.communicator());
     Parallel::broadCast(sigma2,   0, normals.communicator());
+    Parallel::reduceSum(redundancy,   0, normals.communicator());
+    Parallel::reduceSum(traceColumns, 0, normals.communicator());
+    if(Parallel::isMaster(normals.communicator()) && (redundancy > 0))
+      redundancyAccuracy = Vce::monteCarloStandardDeviation(traceColumns)/redundancy;
 
     return (++iter >= 3); // ready after 2 iterations
   }
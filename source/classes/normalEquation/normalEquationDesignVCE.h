@@ -63,6 +63,7 @@ class NormalEquationDesignVCE : public NormalEquationBase
   UInt                 iter;
   UInt                 startIndex;
   std::vector<Double>  sigma2;
+  Double               redundancyAccuracy; // relative standard deviation of the Monte-Carlo estimated redundancy
   ObservationPtr       observation;
   std::vector<UInt>    intervals;
 
@@ -77,6 +78,7 @@ public:
                            MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount) override;
   Vector contribution(MatrixDistributed &Cov) override;
   std::vector<Double> varianceComponentFactors() const override {return sigma2;}
+  Double redundancyError() const override {return redundancyAccuracy;}
 };
 
 /***********************************************/
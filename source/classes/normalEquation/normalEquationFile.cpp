@@ -16,6 +16,7 @@
 #include "files/fileMatrix.h"
 #include "files/fileNormalEquation.h"
 #include "parallel/parallel.h"
+#include "misc/varianceComponentEstimation.h"
 #include "parallel/matrixDistributed.h"
 #include "classes/normalEquation/normalEquation.h"
 #include "classes/normalEquation/normalEquationFile.h"
@@ -44,6 +45,7 @@ NormalEquationFile::NormalEquationFile(Config &config)
     obsCount  = info.observationCount;
     names     = info.parameterName;
     sigma2    = sigma * sigma;
+    redundancyAccuracy = 0;
   }
   catch(std::exception &e)
   {
@@ -132,7 +134,11 @@ Bool NormalEquationFile::addNormalEquation(UInt rhsNo, const const_MatrixSlice &
         // aposteriori sigma
         const Double sigma2Old = sigma2;
         const Double ePe = inner(vx, Nvx) - 2*inner(vx, n.column(rhsNo)) + lPl(rhsNo);
-        const Double r   = obsCount - inner(Wz, NWz)/sigma2;
+        Vector traceColumns(Wz.columns());
+        for(UInt k=0; k<Wz.columns(); k++)
+          traceColumns(k) = inner(Wz.column(k), NWz.column(k))/sigma2;
+        const Double r   = obsCount - sum(traceColumns);
+        redundancyAccuracy = Vce::monteCarloStandardDeviation(traceColumns)/r;
         sigma2 = ePe/r;
         ready  = (std::fabs(std::sqrt(sigma2)-std::sqrt(sigma2Old))/std::sqrt(sigma2) < 0.01);
       }
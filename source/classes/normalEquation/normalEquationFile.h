@@ -43,6 +43,7 @@ class NormalEquationFile : public NormalEquationBase
   Matrix             n;
   Vector             lPl;
   Double             sigma2;
+  Double             redundancyAccuracy; // relative standard deviation of the Monte-Carlo estimated redundancy
 
 public:
   NormalEquationFile(Config &config);
@@ -55,6 +56,7 @@ public:
                            MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount) override;
   Vector contribution(MatrixDistributed &Cov) override;
   std::vector<Double> varianceComponentFactors() const override {return std::vector<Double>({sigma2});}
+  Double redundancyError() const override {return redundancyAccuracy;}
 };
 
 /***********************************************/
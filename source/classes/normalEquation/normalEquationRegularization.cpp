@@ -15,6 +15,7 @@
 #include "config/config.h"
 #include "files/fileMatrix.h"
 #include "parallel/parallel.h"
+#include "misc/varianceComponentEstimation.h"
 #include "classes/normalEquation/normalEquation.h"
 #include "classes/normalEquation/normalEquationRegularization.h"
 
@@ -37,6 +38,7 @@ NormalEquationRegularization::NormalEquationRegularization(Config &config)
     obsCount  = 0;
     rhsCount  = 1;
     sigma2    = sigma*sigma;
+    redundancyAccuracy = 0;
 
     if(!diagName.empty())
     {
@@ -121,9 +123,12 @@ Bool NormalEquationRegularization::addNormalEquation(UInt rhsNo, const const_Mat
         for(UInt i=0; i<paraCount; i++)
           ePe += (vx(i)-bias(i, rhsNo)) * K(i) * (vx(i)-bias(i, rhsNo)); // = (x-n)'K(x-n)
         // redundancy (monte carlo estimation)
-        Double r = static_cast<Double>(this->obsCount);
+        Vector traceColumns(Wz.columns());
         for(UInt i=0; i<paraCount; i++)
-          r -= 1/sigma2 * K(i) * quadsum(Wz.row(i+startIndex)); // = z'W'KWz
+          for(UInt k=0; k<Wz.columns(); k++)
+            traceColumns(k) += 1/sigma2 * K(i) * std::pow(Wz(i+startIndex, k), 2); // = z'W'KWz
+        const Double r = this->obsCount - sum(traceColumns);
+        redundancyAccuracy = Vce::monteCarloStandardDeviation(traceColumns)/r;
         // aposteriori sigma
         const Double sigma2Old = sigma2;
         sigma2 = ePe/r;
@@ -52,6 +52,7 @@ class NormalEquationRegularization : public NormalEquationBase
   UInt    startIndex;
   UInt    paraCount, rhsCount, obsCount;
   Double  sigma2;
+  Double  redundancyAccuracy; // relative standard deviation of the Monte-Carlo estimated redundancy
 
 public:
   NormalEquationRegularization(Config &config);
@@ -64,6 +65,7 @@ public:
                            MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount) override;
   Vector contribution(MatrixDistributed &Cov) override;
   std::vector<Double> varianceComponentFactors() const override {return std::vector<Double>({sigma2});}
+  Double redundancyError() const override {return redundancyAccuracy;}
 };
 
 /***********************************************/
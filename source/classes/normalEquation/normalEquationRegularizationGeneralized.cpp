@@ -15,6 +15,7 @@
 #include "config/config.h"
 #include "files/fileMatrix.h"
 #include "parallel/parallel.h"
+#include "misc/varianceComponentEstimation.h"
 #include "classes/normalEquation/normalEquation.h"
 #include "classes/normalEquation/normalEquationRegularizationGeneralized.h"
 
@@ -38,6 +39,7 @@ NormalEquationRegularizationGeneralized::NormalEquationRegularizationGeneralized
       throw(Exception("Number of partial covariance matrices and apriori sigmas do not match ("+fileNamesCovariance.size()%"%i"s+" vs. "+ sigma2.size()%"%i"s+")."));
     for(Double &s2 : sigma2)
       s2 *= s2;
+    redundancyAccuracy = 0;
 
     if(!fileNameBias.empty())
     {
@@ -147,6 +149,7 @@ Bool NormalEquationRegularizationGeneralized::addNormalEquation(UInt rhsNo, cons
     {
       Matrix Se  = symMatMult(Sigma, bias.column(rhsNo) - x.slice(startIndex, rhsNo, paraCount, 1));
       Matrix SWz = symMatMult(Sigma, Wz.row(startIndex, paraCount));
+      redundancyAccuracy = 0;
       Parallel::broadCast(Se,  0, normals.communicator());
       Parallel::broadCast(SWz, 0, normals.communicator());
 
@@ -173,8 +176,13 @@ Bool NormalEquationRegularizationGeneralized::addNormalEquation(UInt rhsNo, cons
 
         if(Parallel::isMaster(normals.communicator()))
         {
+          Vector traceColumns(SWz.columns());
+          for(UInt k=0; k<SWz.columns(); k++)
+            traceColumns(k) = inner(SWz.column(k), VSWz.column(k));
+          const Double redundancy = r-sum(traceColumns);
+          redundancyAccuracy = std::max(redundancyAccuracy, Vce::monteCarloStandardDeviation(traceColumns)/redundancy);
           const Double sigma2Old = sigma2.at(j);
-          sigma2.at(j) *= inner(Se, VSe)/(r-inner(SWz, VSWz));
+          sigma2.at(j) *= inner(Se, VSe)/redundancy;
           ready = ready && (std::fabs(std::sqrt(sigma2.at(j))-std::sqrt(sigma2Old))/std::sqrt(sigma2.at(j)) < 0.01);
         }
       }
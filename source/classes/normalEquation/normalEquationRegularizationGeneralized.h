@@ -54,6 +54,7 @@ class NormalEquationRegularizationGeneralized : public NormalEquationBase
   UInt                  startIndex, startBlock;
   UInt                  paraCount, rhsCount;
   std::vector<Double>   sigma2;
+  Double                redundancyAccuracy; // relative standard deviation of the Monte-Carlo estimated redundancies (maximum)
   MatrixDistributed     Sigma; // = sum_i sigma2_i * V_i
   std::vector<MatrixDistributed> V;
 
@@ -68,6 +69,7 @@ public:
                            MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount) override;
   Vector contribution(MatrixDistributed &Cov) override;
   std::vector<Double> varianceComponentFactors() const override {return sigma2;}
+  Double redundancyError() const override {return redundancyAccuracy;}
 };
 
 /***********************************************/
@@ -57,6 +57,8 @@ ObservationGradiometer::ObservationGradiometer(Config &config)
 
     orbitFile.open(orbitName);
     starCameraFile.open(starCameraName);
+    orbitFile.setReadAhead(3);
+    starCameraFile.setReadAhead(3);
 
     InstrumentFile::checkArcCount({orbitFile, starCameraFile});
     for(UInt rhsNo=0; rhsNo<rhs.size(); rhsNo++)
@@ -56,6 +56,8 @@ ObservationPodEnergy::ObservationPodEnergy(Config &config)
     // ---------------------
     orbitFile.open(orbitName);
     starCameraFile.open(starCameraName);
+    orbitFile.setReadAhead(3);
+    starCameraFile.setReadAhead(3);
     InstrumentFile::checkArcCount({orbitFile, starCameraFile});
     for(UInt j=0; j<rhs.size(); j++)
       InstrumentFile::checkArcCount({orbitFile, *rhs.at(j)->orbitFile, *rhs.at(j)->accelerometerFile});
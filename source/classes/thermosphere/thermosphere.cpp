@@ -14,6 +14,8 @@
 #define DOCSTRING_Thermosphere
 
 #include "base/import.h"
+#include <mutex>
+#include <thread>
 #include "external/hwm/hwm.h"
 #include "config/configRegister.h"
 #include "classes/thermosphere/thermosphereJB2008.h"
@@ -55,15 +57,138 @@ ThermospherePtr Thermosphere::create(Config &config, const std::string &name)
 
 /***********************************************/
 
-Vector Thermosphere::getIndices(const MiscValuesArc &arc, const Time &time, Bool interpolate)
+// the external Fortran models use global state
+static std::mutex &externalModelMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+/***********************************************/
+
+void Thermosphere::state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const
+{
+  try
+  {
+    std::unique_lock<std::mutex> lock(externalModelMutex()); // also protects the index cursors
+    const Vector index = indices(time);
+    const Double ap    = (!fileNameHwm14Path.empty() && magnetic3hAp.size()) ? getIndices(magnetic3hAp, time, FALSE, cursorMagnetic3hAp)(0) : -1;
+    if(isReentrant() && fileNameHwm14Path.empty())
+      lock.unlock();
+    densityTemperature(time, index, position, density, temperature);
+    velocity = wind(time, position, ap);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void Thermosphere::state(const std::vector<Time> &times, const std::vector<Vector3d> &positions,
+                         std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const
+{
+  try
+  {
+    if(times.size() != positions.size())
+      throw(Exception("size mismatch: "+times.size()%"%i times, "s+positions.size()%"%i positions"s));
+
+    density.resize(times.size());
+    temperature.resize(times.size());
+    velocity.resize(times.size());
+    if(!times.size())
+      return;
+
+    // indices for each time (consecutive equal times share the indices)
+    // ------------------------------------------------------------------
+    std::vector<UInt>   idIndex(times.size());
+    std::vector<Vector> listIndices;
+    std::vector<Double> listAp;
+    {
+      std::lock_guard<std::mutex> lock(externalModelMutex()); // also protects the index cursors
+      for(UInt i=0; i<times.size(); i++)
+      {
+        if(!i || (times.at(i) != times.at(i-1)))
+        {
+          listIndices.push_back(indices(times.at(i)));
+          listAp.push_back((!fileNameHwm14Path.empty() && magnetic3hAp.size()) ? getIndices(magnetic3hAp, times.at(i), FALSE, cursorMagnetic3hAp)(0) : -1);
+        }
+        idIndex.at(i) = listIndices.size()-1;
+      }
+    }
+
+    auto evaluate = [&](UInt start, UInt end)
+    {
+      for(UInt i=start; i<end; i++)
+      {
+        densityTemperature(times.at(i), listIndices.at(idIndex.at(i)), positions.at(i), density.at(i), temperature.at(i));
+        velocity.at(i) = wind(times.at(i), positions.at(i), listAp.at(idIndex.at(i)));
+      }
+    };
+
+    // serialized evaluation of non reentrant models
+    // ---------------------------------------------
+    const UInt threadCount = std::min(static_cast<UInt>(std::thread::hardware_concurrency()), times.size()/100);
+    if(!isReentrant() || !fileNameHwm14Path.empty() || (threadCount < 2))
+    {
+      std::unique_lock<std::mutex> lock(externalModelMutex(), std::defer_lock);
+      if(!isReentrant() || !fileNameHwm14Path.empty())
+        lock.lock();
+      evaluate(0, times.size());
+      return;
+    }
+
+    // concurrent evaluation
+    // ---------------------
+    std::vector<std::thread>        threads;
+    std::vector<std::exception_ptr> exceptions(threadCount);
+    for(UInt idThread=0; idThread<threadCount; idThread++)
+      threads.emplace_back([&, idThread]()
+      {
+        try
+        {
+          evaluate(idThread*times.size()/threadCount, (idThread+1)*times.size()/threadCount);
+        }
+        catch(...)
+        {
+          exceptions.at(idThread) = std::current_exception();
+        }
+      });
+    for(auto &thread : threads)
+      thread.join();
+    for(auto &exception : exceptions)
+      if(exception)
+        std::rethrow_exception(exception);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Vector Thermosphere::getIndices(const MiscValuesArc &arc, const Time &time, Bool interpolate, UInt &cursor)
 {
   try
   {
     const Time timeUt = timeGPS2UTC(time);
-    auto iter = std::upper_bound(arc.begin(), arc.end(), timeUt, [](const Time &time, auto &epoch) {return time < epoch.time;});
-    if((iter == arc.begin()) || (iter == arc.end()))
-      throw(Exception("Cannot find index for "+time.dateTimeStr()));
-    iter--;
+    // arc.at(cursor).time <= timeUt < arc.at(cursor+1).time
+    if((cursor+1 >= arc.size()) || (timeUt < arc.at(cursor).time) || (arc.at(cursor+1).time <= timeUt))
+    {
+      // neighboring interval (monotonic times)
+      if((cursor+2 < arc.size()) && (arc.at(cursor+1).time <= timeUt) && (timeUt < arc.at(cursor+2).time))
+        cursor++;
+      else
+      {
+        auto iter = std::upper_bound(arc.begin(), arc.end(), timeUt, [](const Time &time, auto &epoch) {return time < epoch.time;});
+        if((iter == arc.begin()) || (iter == arc.end()))
+          throw(Exception("Cannot find index for "+time.dateTimeStr()));
+        cursor = std::distance(arc.begin(), iter)-1;
+      }
+    }
+    auto iter = arc.begin()+cursor;
     if(!interpolate)
       return iter->values;
     const Double t = (timeUt - iter->time).seconds()/((iter+1)->time - iter->time).seconds();
@@ -77,7 +202,7 @@ Vector Thermosphere::getIndices(const MiscValuesArc &arc, const Time &time, Bool
 
 /***********************************************/
 
-Vector3d Thermosphere::wind(const Time &time, const Vector3d &position) const
+Vector3d Thermosphere::wind(const Time &time, const Vector3d &position, Double ap) const
 {
   try
   {
@@ -87,10 +212,6 @@ Vector3d Thermosphere::wind(const Time &time, const Vector3d &position) const
     if(fileNameHwm14Path.empty())
       return Vector3d();
 
-    Double ap2 = -1;
-    if(magnetic3hAp.size())
-      ap2 = getIndices(magnetic3hAp, time, FALSE)(0);
-
     Ellipsoid ellipsoid;
     Angle     lon, lat;
     Double    height;
@@ -108,8 +229,8 @@ Vector3d Thermosphere::wind(const Time &time, const Vector3d &position) const
     setenv("HWMPATH", fileNameHwm14Path.c_str(), 1);
 #endif
     F77Float outf[2];
-    const F77Float ap[] = {0.0, static_cast<F77Float>(ap2)};
-    hwm(yyddd, 3600*hour+60*min+seconds, height*0.001, lat*RAD2DEG, std::fmod(lon*RAD2DEG+360, 360), 0, 0., 0., ap, outf);
+    const F77Float aps[] = {0.0, static_cast<F77Float>(ap)};
+    hwm(yyddd, 3600*hour+60*min+seconds, height*0.001, lat*RAD2DEG, std::fmod(lon*RAD2DEG+360, 360), 0, 0., 0., aps, outf);
 #ifndef _WIN32
     unsetenv("HWMPATH");
 #endif
@@ -45,10 +45,18 @@ typedef std::shared_ptr<Thermosphere> ThermospherePtr;
 /***** CLASS ***********************************/
 
 /** @brief Density, temperature and velocity.
-* An Instance of this class can be created by @ref readConfig. */
+* An Instance of this class can be created by @ref readConfig.
+*
+* Thread safety: The external Fortran models NRLMSIS2 and HWM14 use global state
+* and are not reentrant. All evaluations of non reentrant models are therefore serialized
+* with a process wide lock (also across different instances). Models with @a isReentrant() (JB2008)
+* and without wind model are evaluated concurrently in the batched @a state. */
 class Thermosphere
 {
 public:
+  /// Constructor.
+  Thermosphere() : cursorMagnetic3hAp(0) {}
+
   /// Destructor.
   virtual ~Thermosphere() {}
 
@@ -58,18 +66,43 @@ public:
   * @param[out] density  [kg/m^3]
   * @param[out] temperature  [K]
   * @param[out] velocity wind in TRF [m/s] */
-  virtual void state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const = 0;
+  void state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const;
+
+  /** @brief Thermospheric state at a list of points.
+  * Consecutive points with the same time share the space weather indices.
+  * Sorted times are most efficient (monotonic search of the indices).
+  * @param times GPS time of each point
+  * @param positions in TRF [m]
+  * @param[out] density  [kg/m^3]
+  * @param[out] temperature  [K]
+  * @param[out] velocity wind in TRF [m/s] */
+  void state(const std::vector<Time> &times, const std::vector<Vector3d> &positions,
+             std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const;
 
   /** @brief creates an derived instance of this class. */
   static ThermospherePtr create(Config &config, const std::string &name);
 
 protected:
-  FileName fileNameHwm14Path;
+  FileName      fileNameHwm14Path;
+  MiscValuesArc magnetic3hAp;
 
-  static Vector getIndices(const MiscValuesArc &arc, const Time &time, Bool interpolate);
+  /** @brief Space weather indices needed by the model at @a time (model specific). */
+  virtual Vector indices(const Time &time) const = 0;
 
-  MiscValuesArc magnetic3hAp;
-  Vector3d wind(const Time &time, const Vector3d &position) const;
+  /** @brief Density and temperature with the @a indices of @a time. */
+  virtual void densityTemperature(const Time &time, const Vector &indices, const Vector3d &position, Double &density, Double &temperature) const = 0;
+
+  /** @brief Can @a densityTemperature be called concurrently? */
+  virtual Bool isReentrant() const {return FALSE;}
+
+  /** @brief Values of @a arc at @a time (UTC interval of the epochs).
+  * @a cursor is the epoch index of the last call and speeds up the search for monotonic times. */
+  static Vector getIndices(const MiscValuesArc &arc, const Time &time, Bool interpolate, UInt &cursor);
+
+private:
+  mutable UInt cursorMagnetic3hAp;
+
+  Vector3d wind(const Time &time, const Vector3d &position, Double ap) const;
 };
 
 /***** FUNCTIONS *******************************/
@@ -41,16 +41,20 @@ class ThermosphereJB2008 : public Thermosphere
 {
   MiscValuesArc solarFSMY;
   MiscValuesArc dtc;
+  mutable UInt  cursor1, cursor2, cursor5, cursorDtc;
+
+  inline Vector indices(const Time &time) const override;
+  inline void   densityTemperature(const Time &time, const Vector &indices, const Vector3d &position, Double &density, Double &temperature) const override;
+  Bool isReentrant() const override {return TRUE;} // JB2008 has no global state (only constants in DATA statements)
 
 public:
   inline ThermosphereJB2008(Config &config);
 
-  inline void state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const override;
 };
 
 /***********************************************/
 
-inline ThermosphereJB2008::ThermosphereJB2008(Config &config)
+inline ThermosphereJB2008::ThermosphereJB2008(Config &config) : cursor1(0), cursor2(0), cursor5(0), cursorDtc(0)
 {
   try
   {
@@ -121,35 +125,50 @@ inline ThermosphereJB2008::ThermosphereJB2008(Config &config)
 
 /***********************************************/
 
-inline void ThermosphereJB2008::state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const
+// F10, F10B, S10, S10B, M10, M10B, Y10, Y10B, DSTDTC
+inline Vector ThermosphereJB2008::indices(const Time &time) const
 {
   try
   {
-#ifndef GROOPS_DISABLE_JB2008
-    Ellipsoid ellipsoid;
-    Angle     lon, lat;
-    Double    height;
-    ellipsoid(position, lon, lat, height);
-
-    // use 5 day lag for y10 for jb2008
-    const Vector index5 = getIndices(solarFSMY, time - mjd2time(5), FALSE);
-    const Double Y10  = index5(6);
-    const Double Y10B = index5(7);
+    Vector index(9);
+    // use 1 day lag for f10 and s10 for jb2008
+    const Vector index1 = getIndices(solarFSMY, time - mjd2time(1), FALSE, cursor1);
+    index(0) = index1(0);
+    index(1) = index1(1);
+    index(2) = index1(2);
+    index(3) = index1(3);
 
     // use 2 day lag for m10 for jb2008
-    const Vector index2 = getIndices(solarFSMY, time - mjd2time(2), FALSE);
-    const Double M10  = index2(4);
-    const Double M10B = index2(5);
+    const Vector index2 = getIndices(solarFSMY, time - mjd2time(2), FALSE, cursor2);
+    index(4) = index2(4);
+    index(5) = index2(5);
 
-    // use 1 day lag for f10 and s10 for jb2008
-    const Vector index1 = getIndices(solarFSMY, time - mjd2time(1), FALSE);
-    const Double F10  = index1(0);
-    const Double F10B = index1(1);
-    const Double S10  = index1(2);
-    const Double S10B = index1(3);
+    // use 5 day lag for y10 for jb2008
+    const Vector index5 = getIndices(solarFSMY, time - mjd2time(5), FALSE, cursor5);
+    index(6) = index5(6);
+    index(7) = index5(7);
 
     // read geomagnetic storm dtc value
-    const Double dstdtc = getIndices(dtc, time, TRUE)(0);
+    index(8) = getIndices(dtc, time, TRUE, cursorDtc)(0);
+    return index;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline void ThermosphereJB2008::densityTemperature(const Time &time, const Vector &index, const Vector3d &position, Double &density, Double &temperature) const
+{
+  try
+  {
+#ifndef GROOPS_DISABLE_JB2008
+    Ellipsoid ellipsoid;
+    Angle     lon, lat;
+    Double    height;
+    ellipsoid(position, lon, lat, height);
 
     const Vector3d sunPos = Planets::positionSun(time);
 
@@ -157,11 +176,10 @@ inline void ThermosphereJB2008::state(const Time &time, const Vector3d &position
     F77Double pos[3] = {std::fmod(Double(lon+Planets::gmst(timeGPS2UTC(time)))+2*PI, 2*PI), lat, height*1e-3};
     F77Double temp[2], rho;
 
-    jb2008(time.mjd(), sun, pos, F10, F10B, S10, S10B, M10, M10B, Y10, Y10B, dstdtc, temp, rho);
+    jb2008(time.mjd(), sun, pos, index(0), index(1), index(2), index(3), index(4), index(5), index(6), index(7), index(8), temp, rho);
 
     density     = rho;
     temperature = temp[1];
-    velocity    = wind(time, position);
 #endif
   }
   catch(std::exception &e)
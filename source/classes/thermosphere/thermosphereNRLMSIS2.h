@@ -40,16 +40,18 @@ model of temperature and neutral species densities. Earth and Space Science, Vol
 class ThermosphereNRLMSIS2 : public Thermosphere
 {
   MiscValuesArc msisData;
+  mutable UInt  cursor, cursorDaily;
+
+  inline Vector indices(const Time &time) const override;
+  inline void   densityTemperature(const Time &time, const Vector &indices, const Vector3d &position, Double &density, Double &temperature) const override;
 
 public:
   inline ThermosphereNRLMSIS2(Config &config);
-
-  inline void state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const override;
 };
 
 /***********************************************/
 
-inline ThermosphereNRLMSIS2::ThermosphereNRLMSIS2(Config &config)
+inline ThermosphereNRLMSIS2::ThermosphereNRLMSIS2(Config &config) : cursor(0), cursorDaily(0)
 {
   try
   {
@@ -82,7 +84,24 @@ inline ThermosphereNRLMSIS2::ThermosphereNRLMSIS2(Config &config)
 
 /***********************************************/
 
-inline void ThermosphereNRLMSIS2::state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const
+// averageF107, dailyF107 (previous day), 7 ap values
+inline Vector ThermosphereNRLMSIS2::indices(const Time &time) const
+{
+  try
+  {
+    Vector index = getIndices(msisData, time, FALSE, cursor);
+    index(1) = getIndices(msisData, time-mjd2time(1), FALSE, cursorDaily)(1);
+    return index;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline void ThermosphereNRLMSIS2::densityTemperature(const Time &time, const Vector &index, const Vector3d &position, Double &density, Double &temperature) const
 {
   try
   {
@@ -96,8 +115,7 @@ inline void ThermosphereNRLMSIS2::state(const Time &time, const Vector3d &positi
 
     // get data
     const Time     timeUt      =  timeGPS2UTC(time);
-    const Vector   index       =  getIndices(msisData, time, FALSE);
-    const F77Float dailyF107   =  static_cast<F77Float>(getIndices(msisData, time-mjd2time(1), FALSE)(1));
+    const F77Float dailyF107   =  static_cast<F77Float>(index(1));
     const F77Float averageF107 =  static_cast<F77Float>(index(0));
     const F77Float aps[7]      = {static_cast<F77Float>(index(2)),
                                   static_cast<F77Float>(index(3)),
@@ -112,7 +130,6 @@ inline void ThermosphereNRLMSIS2::state(const Time &time, const Vector3d &positi
     msiscalcWrapper(timeUt.dayOfYear()+timeUt.mjdMod(), time.mjdMod()*86400, height*1e-3, lat*RAD2DEG, lon*RAD2DEG, averageF107, dailyF107, aps, tempAlt, rho, tempExo);
     density     = rho[0];
     temperature = tempAlt;
-    velocity    = wind(time, position);
 #endif
   }
   catch(std::exception &e)
@@ -187,14 +187,15 @@ void TidesDoodsonHarmonic::deformation(const std::vector<Time> &time, const std:
     if((time.size()==0) || (point.size()==0))
       return;
 
+    // station design computed once, applied to all constituents in one matrix product
     Matrix A = deformationMatrix(point, gravity, hn, ln, GM, R, cnmCos.at(0).rows()-1);
-    std::vector<Matrix> xCos(cnmCos.size());
-    std::vector<Matrix> xSin(snmCos.size());
-    for(UInt i=0; i<xCos.size(); i++)
+    Matrix X(A.columns(), 2*cnmCos.size());
+    for(UInt i=0; i<cnmCos.size(); i++)
     {
-      xCos.at(i) = A * SphericalHarmonics(GM, R, cnmCos.at(i), snmCos.at(i)).x();
-      xSin.at(i) = A * SphericalHarmonics(GM, R, cnmSin.at(i), snmSin.at(i)).x();
+      copy(SphericalHarmonics(GM, R, cnmCos.at(i), snmCos.at(i)).x(), X.column(2*i+0));
+      copy(SphericalHarmonics(GM, R, cnmSin.at(i), snmSin.at(i)).x(), X.column(2*i+1));
     }
+    const Matrix D = A * X;
 
     for(UInt idEpoch=0; idEpoch<time.size(); idEpoch++)
     {
@@ -203,8 +204,8 @@ void TidesDoodsonHarmonic::deformation(const std::vector<Time> &time, const std:
       Vector x(3*point.size());
       for(UInt i=0; i<csMajor.rows(); i++)
       {
-        axpy(csMajor(i,0), xCos.at(i), x);
-        axpy(csMajor(i,1), xSin.at(i), x);
+        axpy(csMajor(i,0), D.column(2*i+0), x);
+        axpy(csMajor(i,1), D.column(2*i+1), x);
       }
 
       for(UInt k=0; k<point.size(); k++)
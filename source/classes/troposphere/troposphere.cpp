@@ -58,6 +58,28 @@ TropospherePtr Troposphere::create(Config &config, const std::string &name)
 /***********************************************/
 /***********************************************/
 
+void Troposphere::mappingFunctions(UInt stationId, const Time &time, Double frequency, const Vector &azimuth, const Vector &elevation,
+                                   Vector &delay, Vector &mfHydrostatic, Vector &mfWet, Vector &dx, Vector &dy) const
+{
+  try
+  {
+    delay = mfHydrostatic = mfWet = dx = dy = Vector(elevation.rows());
+    for(UInt i=0; i<elevation.rows(); i++)
+    {
+      delay(i)         = slantDelay                (stationId, time, frequency, Angle(azimuth(i)), Angle(elevation(i)));
+      mfHydrostatic(i) = mappingFunctionHydrostatic(stationId, time, frequency, Angle(azimuth(i)), Angle(elevation(i)));
+      mfWet(i)         = mappingFunctionWet        (stationId, time, frequency, Angle(azimuth(i)), Angle(elevation(i)));
+      mappingFunctionGradient(stationId, time, frequency, Angle(azimuth(i)), Angle(elevation(i)), dx(i), dy(i));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void Troposphere::initEmpiricalCoefficients(const FileName &fileNameGpt, const std::vector<Vector3d> &stationPositions)
 {
   try
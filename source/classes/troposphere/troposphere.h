@@ -95,6 +95,21 @@ public:
   * @param[out] dy  Gradient function value in East direction []. */
   virtual void mappingFunctionGradient(UInt stationId, const Time &time, Double frequency, Angle azimuth, Angle elevation, Double &dx, Double &dy) const = 0;
 
+  /** @brief Slant delay and mapping functions for all observations of one station at one epoch.
+  * The station and epoch dependent coefficients are evaluated only once.
+  * @param stationId Station number from the list given at init.
+  * @param time Time of the measurements.
+  * @param frequency of the electromagnetic signal [Hz].
+  * @param azimuth  Azimuth of each observation.
+  * @param elevation  Elevation of each observation.
+  * @param[out] delay Approx value of the slant delay [m].
+  * @param[out] mfHydrostatic Mapping function of the hydrostatic atmosphere [].
+  * @param[out] mfWet Mapping function of the wet atmosphere [].
+  * @param[out] dx  Gradient function value in North direction [].
+  * @param[out] dy  Gradient function value in East direction []. */
+  virtual void mappingFunctions(UInt stationId, const Time &time, Double frequency, const Vector &azimuth, const Vector &elevation,
+                                Vector &delay, Vector &mfHydrostatic, Vector &mfWet, Vector &dx, Vector &dy) const;
+
 
   /** @brief Get tropospheric zenith dry/wet delay and dry/wet gradients in North and East directions at a specific time stamp.
   * @param stationId Station number from the list given at init.
@@ -123,6 +123,46 @@ void TroposphereGpt::mappingFunctionGradient(UInt /*stationId*/, const Time &/*t
 
 /***********************************************/
 
+void TroposphereGpt::mappingFunctions(UInt stationId, const Time &time, Double /*frequency*/, const Vector &azimuth, const Vector &elevation,
+                                      Vector &delay, Vector &mfHydrostatic, Vector &mfWet, Vector &dx, Vector &dy) const
+{
+  try
+  {
+    computeEmpiricalCoefficients(time);
+
+    const UInt count = elevation.rows();
+    delay = Vector(count); mfHydrostatic = Vector(count); mfWet = Vector(count); dx = Vector(count); dy = Vector(count);
+    const Double *azi = azimuth.field();
+    const Double *ele = elevation.field();
+    Double *pDelay = delay.field(), *pHydro = mfHydrostatic.field(), *pWet = mfWet.field(), *pDx = dx.field(), *pDy = dy.field();
+    const Double ah_ = ah(stationId), bh_ = bh(stationId), ch_ = ch(stationId);
+    const Double aw_ = aw(stationId), bw_ = bw(stationId), cw_ = cw(stationId);
+    const Double heightCorrection = height(stationId)*0.001;
+    for(UInt i=0; i<count; i++)
+    {
+      const Double sinE    = std::sin(ele[i]);
+      const Double sinTanE = sinE*std::tan(ele[i]);
+      const Double cosA    = std::cos(azi[i]);
+      const Double sinA    = std::sin(azi[i]);
+      const Double mfgh    = 1. / (sinTanE + 0.0031); // hydrostatic gradient mapping function [Chen and Herring, 1997]
+      const Double mfgw    = 1. / (sinTanE + 0.0007); // wet -"-
+      pHydro[i] = mappingFunction(sinE, ah_, bh_, ch_) + (1./sinE - mappingFunction(sinE, a_ht, b_ht, c_ht)) * heightCorrection;
+      pWet[i]   = mappingFunction(sinE, aw_, bw_, cw_);
+      pDelay[i] = pHydro[i]*zhd(stationId) + pWet[i]*zwd(stationId)
+                + (mfgh*gnh(stationId) + mfgw*gnw(stationId)) * cosA
+                + (mfgh*geh(stationId) + mfgw*gew(stationId)) * sinA;
+      pDx[i]    = mfgh * cosA;
+      pDy[i]    = mfgh * sinA;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void TroposphereGpt::getAprioriValues(UInt stationId, const Time &time, Double /*frequency*/, Double &zenithDryDelay, Double &zenithWetDelay, Double &gradientDryNorth,
                                       Double &gradientWetNorth, Double &gradientDryEast, Double &gradientWetEast, Double &aDry, Double &aWet) const
 {
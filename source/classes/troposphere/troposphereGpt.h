@@ -51,6 +51,8 @@ public:
   Double mappingFunctionHydrostatic(UInt stationId, const Time &time, Double frequency, Angle azimuth, Angle elevation) const override;
   Double mappingFunctionWet        (UInt stationId, const Time &time, Double frequency, Angle azimuth, Angle elevation) const override;
   void   mappingFunctionGradient   (UInt stationId, const Time &time, Double frequency, Angle azimuth, Angle elevation, Double &dx, Double &dy) const override;
+  void   mappingFunctions          (UInt stationId, const Time &time, Double frequency, const Vector &azimuth, const Vector &elevation,
+                                    Vector &delay, Vector &mfHydrostatic, Vector &mfWet, Vector &dx, Vector &dy) const override;
   void   getAprioriValues          (UInt stationId, const Time &time, Double frequency, Double &zenithDryDelay, Double &zenithWetDelay, Double &gradientDryNorth,
                                     Double &gradientWetNorth, Double &gradientDryEast, Double &gradientWetEast, Double &aDry, Double &aWet) const override;
 };
@@ -46,8 +46,21 @@ class TroposphereMendesAndPavlis : public Troposphere
   Vector                         latitude, height, f;
   std::vector<std::vector<Time>> times;       // for each station
   std::vector<Matrix>            meteorology; // for each station: times x (temperature, pressure, waterVapor)
+  std::vector<Polynomial>        polynomial;  // for each station
+
+  // meteorology interpolated to the last requested epoch of each station
+  struct Meteorology
+  {
+    Bool   isValid;
+    Time   time;
+    Double temperature, pressure, waterVapor;
+  };
+  mutable std::vector<Meteorology> cache;
 
   Matrix interpolate(UInt stationId, const Time &time, const_MatrixSliceRef A) const;
+  const Meteorology &interpolate(UInt stationId, const Time &time) const;
+  Double mappingFunction(UInt stationId, Double temperature, Double sinE) const;
+  using Troposphere::mappingFunction;
 
 public:
   TroposphereMendesAndPavlis(Config &config);
@@ -98,6 +111,9 @@ inline void TroposphereMendesAndPavlis::init(const std::vector<std::string> &sta
     // read station wise meteorology data
     meteorology.resize(stationNames.size());
     times.resize(stationNames.size());
+    polynomial.resize(stationNames.size());
+    cache.clear();
+    cache.resize(stationNames.size(), Meteorology{FALSE, Time(), 0., 0., 0.});
     for(UInt stationId=0; stationId<stationPositions.size(); stationId++)
     {
       VariableList varList;
@@ -114,6 +130,9 @@ inline void TroposphereMendesAndPavlis::init(const std::vector<std::string> &sta
         const Double T = meteorology.at(stationId)(i, 0)-273.15; // temperature [C°]
         meteorology.at(stationId)(i, 2) *= 6.11*std::pow(10, 7.5*T/(237.3+T));
       }
+
+      if(times.at(stationId).size() >= 2)
+        polynomial.at(stationId).init(times.at(stationId), 1, FALSE);
     }
   }
   catch(std::exception &e)
@@ -128,8 +147,14 @@ inline Matrix TroposphereMendesAndPavlis::interpolate(UInt stationId, const Time
 {
   try
   {
-    auto closestTimeIter = std::min_element(times.at(stationId).begin(), times.at(stationId).end(), [&](const Time &t1, const Time &t2)
-                          {return std::fabs((t1-time).seconds()) < std::fabs((t2-time).seconds());});
+    if(!times.at(stationId).size())
+      throw(Exception("no meteorological data for station id "+stationId%"%i"s));
+
+    // times are sorted: closest epoch is one of the neighbors
+    auto closestTimeIter = std::lower_bound(times.at(stationId).begin(), times.at(stationId).end(), time);
+    if((closestTimeIter == times.at(stationId).end()) ||
+       ((closestTimeIter != times.at(stationId).begin()) && (std::fabs((*std::prev(closestTimeIter)-time).seconds()) <= std::fabs((*closestTimeIter-time).seconds()))))
+      closestTimeIter--;
 
     Time closestTime = *closestTimeIter;
 
@@ -152,8 +177,7 @@ inline Matrix TroposphereMendesAndPavlis::interpolate(UInt stationId, const Time
 
       if((std::fabs(closestTime.seconds() - (*closestTimeNeighbourIter).seconds()) < 60*60) && (closestTimeNeighbourIter != closestTimeIter))
       {
-        Polynomial polynomial(times.at(stationId), 1, FALSE);
-        Matrix interpolatedValues = polynomial.interpolate({time}, A);
+        Matrix interpolatedValues = polynomial.at(stationId).interpolate({time}, A);
 
         // Check if interpolation was done
         if(!std::isnan(sum(interpolatedValues)))
@@ -187,6 +211,57 @@ inline Matrix TroposphereMendesAndPavlis::interpolate(UInt stationId, const Time
 
 /***********************************************/
 
+inline const TroposphereMendesAndPavlis::Meteorology &TroposphereMendesAndPavlis::interpolate(UInt stationId, const Time &time) const
+{
+  try
+  {
+    Meteorology &m = cache.at(stationId);
+    if(m.isValid && (m.time == time))
+      return m;
+
+    const Matrix M = interpolate(stationId, time, meteorology.at(stationId));
+    m.isValid     = TRUE;
+    m.time        = time;
+    m.temperature = M(0, 0);
+    m.pressure    = M(0, 1);
+    m.waterVapor  = M(0, 2);
+    return m;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline Double TroposphereMendesAndPavlis::mappingFunction(UInt stationId, Double temperature, Double sinE) const
+{
+  // FCULa source: IERS 2010 conventions, Table 9.1
+  constexpr Double a10 = 12100.8e-7;
+  constexpr Double a11 =  1729.5e-9;
+  constexpr Double a12 =   319.1e-7;
+  constexpr Double a13 = -1847.8e-11;
+  constexpr Double a20 = 30496.5e-7;
+  constexpr Double a21 =   234.6e-8;
+  constexpr Double a22 =  -103.5e-6;
+  constexpr Double a23 =  -185.6e-10;
+  constexpr Double a30 =  6877.7e-5;
+  constexpr Double a31 =   197.2e-7;
+  constexpr Double a32 =  -345.8e-5;
+  constexpr Double a33 =   106.0e-9;
+
+  const Double T    = temperature-273.15; // convert temperature in [°C]
+  const Double cosL = std::cos(latitude(stationId));
+  const Double a1   = a10 + a11*T + a12*cosL + a13*height(stationId);
+  const Double a2   = a20 + a21*T + a22*cosL + a23*height(stationId);
+  const Double a3   = a30 + a31*T + a32*cosL + a33*height(stationId);
+
+  return mappingFunction(sinE, a1, a2, a3);
+}
+
+/***********************************************/
+
 inline Double TroposphereMendesAndPavlis::slantDelay(UInt stationId, const Time &time, Double frequency, Angle azimuth, Angle elevation) const
 {
   try
@@ -207,27 +282,7 @@ inline Double TroposphereMendesAndPavlis::mappingFunctionHydrostatic(UInt statio
 {
   try
   {
-    // FCULa source: IERS 2010 conventions, Table 9.1
-    constexpr Double a10 = 12100.8e-7;
-    constexpr Double a11 =  1729.5e-9;
-    constexpr Double a12 =   319.1e-7;
-    constexpr Double a13 = -1847.8e-11;
-    constexpr Double a20 = 30496.5e-7;
-    constexpr Double a21 =   234.6e-8;
-    constexpr Double a22 =  -103.5e-6;
-    constexpr Double a23 =  -185.6e-10;
-    constexpr Double a30 =  6877.7e-5;
-    constexpr Double a31 =   197.2e-7;
-    constexpr Double a32 =  -345.8e-5;
-    constexpr Double a33 =   106.0e-9;
-
-    const Double T    = interpolate(stationId, time, meteorology.at(stationId).column(0))(0, 0)-273.15; // convert temperature in [°C]
-    const Double cosL = std::cos(latitude(stationId));
-    const Double a1   = a10 + a11*T + a12*cosL + a13*height(stationId);
-    const Double a2   = a20 + a21*T + a22*cosL + a23*height(stationId);
-    const Double a3   = a30 + a31*T + a32*cosL + a33*height(stationId);
-
-    return mappingFunction(std::sin(elevation), a1, a2, a3);
+    return mappingFunction(stationId, interpolate(stationId, time).temperature, std::sin(elevation));
   }
   catch(std::exception &e)
   {
@@ -283,9 +338,9 @@ inline void TroposphereMendesAndPavlis::getAprioriValues(UInt stationId, const T
     const Double fh   = 1e-2 * (k1*(k0+sigma2)/std::pow((k0-sigma2), 2) + k3*(k2+sigma2)/std::pow(k2-sigma2, 2)) * cco2;
     const Double fnh  = 0.003101 * (omega0 + 3*omega1*sigma2 + 5*omega2*std::pow(sigma2, 2) + 7*omega3*std::pow(sigma2, 3));
 
-    const Matrix M = interpolate(stationId, time, meteorology.at(stationId)).column(1, 2); // pressure [Pa], waterVaporPressure [Pa]
-    zenithDryDelay = 0.00002416579*fh/f(stationId) * M(0, 0)/*pressure*/;
-    zenithWetDelay = (5.316e-6*fnh - 3.759e-6*fh)/f(stationId) * M(0, 1)/*waterVaporPressure*/;
+    const Meteorology &m = interpolate(stationId, time);
+    zenithDryDelay = 0.00002416579*fh/f(stationId) * m.pressure;
+    zenithWetDelay = (5.316e-6*fnh - 3.759e-6*fh)/f(stationId) * m.waterVapor;
 
     gradientDryNorth = gradientWetNorth = gradientDryEast = gradientWetEast = 0.;
     aDry = aWet = 0.;
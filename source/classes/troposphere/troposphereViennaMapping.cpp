@@ -116,6 +116,9 @@ void TroposphereViennaMapping::init(const std::vector<std::string> &/*stationNam
       }
     }
 
+    cache.clear();
+    cache.resize(stationPositions.size(), Coefficients{FALSE, Time(), 0., 0., 0., 0., 0., 0., 0., 0.});
+
     ah  = Matrix(times.size(), stationPositions.size());
     aw  = Matrix(times.size(), stationPositions.size());
     zhd = Matrix(times.size(), stationPositions.size());
@@ -208,32 +211,52 @@ void TroposphereViennaMapping::findIndex(const Time &time, UInt &idx, Double &ta
 
 /***********************************************/
 
-Double TroposphereViennaMapping::slantDelay(UInt stationId, const Time &time, Double /*frequency*/, Angle azimuth, Angle elevation) const
+const TroposphereViennaMapping::Coefficients &TroposphereViennaMapping::coefficients(UInt stationId, const Time &time) const
 {
   try
   {
+    Coefficients &c = cache.at(stationId);
+    if(c.isValid && (c.time == time))
+      return c;
+
     UInt   idx;
     Double tau;
     findIndex(time, idx, tau);
-    computeEmpiricalCoefficients(time);
+    c.isValid = TRUE;
+    c.time    = time;
+    c.ah      = (1-tau) * ah (idx, stationId) + tau * ah (idx+1, stationId);
+    c.aw      = (1-tau) * aw (idx, stationId) + tau * aw (idx+1, stationId);
+    c.zhd     = (1-tau) * zhd(idx, stationId) + tau * zhd(idx+1, stationId);
+    c.zwd     = (1-tau) * zwd(idx, stationId) + tau * zwd(idx+1, stationId);
+    c.gnh     = (1-tau) * gnh(idx, stationId) + tau * gnh(idx+1, stationId);
+    c.geh     = (1-tau) * geh(idx, stationId) + tau * geh(idx+1, stationId);
+    c.gnw     = (1-tau) * gnw(idx, stationId) + tau * gnw(idx+1, stationId);
+    c.gew     = (1-tau) * gew(idx, stationId) + tau * gew(idx+1, stationId);
+    return c;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
 
-    const Double _ah  = (1-tau) * ah (idx, stationId) + tau * ah (idx+1, stationId);
-    const Double _aw  = (1-tau) * aw (idx, stationId) + tau * aw (idx+1, stationId);
-    const Double _zhd = (1-tau) * zhd(idx, stationId) + tau * zhd(idx+1, stationId);
-    const Double _zwd = (1-tau) * zwd(idx, stationId) + tau * zwd(idx+1, stationId);
-    const Double _gnh = (1-tau) * gnh(idx, stationId) + tau * gnh(idx+1, stationId);
-    const Double _geh = (1-tau) * gnw(idx, stationId) + tau * gnw(idx+1, stationId);
-    const Double _gnw = (1-tau) * geh(idx, stationId) + tau * geh(idx+1, stationId);
-    const Double _gew = (1-tau) * gew(idx, stationId) + tau * gew(idx+1, stationId);
+Double TroposphereViennaMapping::slantDelay(UInt stationId, const Time &time, Double /*frequency*/, Angle azimuth, Angle elevation) const
+{
+  try
+  {
+    const Coefficients &c = coefficients(stationId, time);
+    computeEmpiricalCoefficients(time);
 
     const Double sinE = std::sin(elevation);
-    const Double vmfh = mappingFunction(sinE, _ah, bh(stationId), ch(stationId))
+    const Double vmfh = mappingFunction(sinE, c.ah, bh(stationId), ch(stationId))
                       + (1./sinE - mappingFunction(sinE, a_ht, b_ht, c_ht)) * height(stationId)*0.001;
-    const Double vmfw = mappingFunction(sinE, _aw, bw(stationId), cw(stationId));
+    const Double vmfw = mappingFunction(sinE, c.aw, bw(stationId), cw(stationId));
     const Double mfgh = 1. / (sinE*std::tan(elevation) + 0.0031); // hydrostatic gradient mapping function [Chen and Herring, 1997]
     const Double mfgw = 1. / (sinE*std::tan(elevation) + 0.0007); // wet -"-
 
-    return vmfh*_zhd + vmfw*_zwd + (mfgh*_gnh + mfgw*_gnw) * std::cos(azimuth) + (mfgh*_geh + mfgw*_gew) * std::sin(azimuth);
+    return vmfh*c.zhd + vmfw*c.zwd + (mfgh*c.gnh + mfgw*c.gnw) * std::cos(azimuth) + (mfgh*c.geh + mfgw*c.gew) * std::sin(azimuth);
   }
   catch(std::exception &e)
   {
@@ -247,14 +270,12 @@ Double TroposphereViennaMapping::mappingFunctionHydrostatic(UInt stationId, cons
 {
   try
   {
-    UInt   idx;
-    Double tau;
-    findIndex(time, idx, tau);
+    const Coefficients &c = coefficients(stationId, time);
     computeEmpiricalCoefficients(time);
 
     const Double sinE  = std::sin(elevation);
 
-    return mappingFunction(sinE, (1-tau) * ah(idx, stationId) + tau * ah(idx+1, stationId), bh(stationId), ch(stationId))
+    return mappingFunction(sinE, c.ah, bh(stationId), ch(stationId))
            + (1./sinE - mappingFunction(sinE, a_ht, b_ht, c_ht)) * height(stationId)*0.001;
   }
   catch(std::exception &e)
@@ -269,12 +290,10 @@ Double TroposphereViennaMapping::mappingFunctionWet(UInt stationId, const Time &
 {
   try
   {
-    UInt   idx;
-    Double tau;
-    findIndex(time, idx, tau);
+    const Coefficients &c = coefficients(stationId, time);
     computeEmpiricalCoefficients(time);
 
-    return mappingFunction(std::sin(elevation), (1-tau) * aw(idx, stationId) + tau * aw(idx+1, stationId), bw(stationId), cw(stationId));
+    return mappingFunction(std::sin(elevation), c.aw, bw(stationId), cw(stationId));
   }
   catch(std::exception &e)
   {
@@ -300,24 +319,59 @@ void TroposphereViennaMapping::mappingFunctionGradient(UInt /*stationId*/, const
 
 /***********************************************/
 
+void TroposphereViennaMapping::mappingFunctions(UInt stationId, const Time &time, Double /*frequency*/, const Vector &azimuth, const Vector &elevation,
+                                                Vector &delay, Vector &mfHydrostatic, Vector &mfWet, Vector &dx, Vector &dy) const
+{
+  try
+  {
+    const Coefficients &c = coefficients(stationId, time);
+    computeEmpiricalCoefficients(time);
+
+    const UInt count = elevation.rows();
+    delay = Vector(count); mfHydrostatic = Vector(count); mfWet = Vector(count); dx = Vector(count); dy = Vector(count);
+    const Double *azi = azimuth.field();
+    const Double *ele = elevation.field();
+    Double *pDelay = delay.field(), *pHydro = mfHydrostatic.field(), *pWet = mfWet.field(), *pDx = dx.field(), *pDy = dy.field();
+    const Double bh_ = bh(stationId), ch_ = ch(stationId), bw_ = bw(stationId), cw_ = cw(stationId);
+    const Double heightCorrection = height(stationId)*0.001;
+    for(UInt i=0; i<count; i++)
+    {
+      const Double sinE    = std::sin(ele[i]);
+      const Double sinTanE = sinE*std::tan(ele[i]);
+      const Double cosA    = std::cos(azi[i]);
+      const Double sinA    = std::sin(azi[i]);
+      const Double mfgh    = 1. / (sinTanE + 0.0031); // hydrostatic gradient mapping function [Chen and Herring, 1997]
+      const Double mfgw    = 1. / (sinTanE + 0.0007); // wet -"-
+      pHydro[i] = mappingFunction(sinE, c.ah, bh_, ch_) + (1./sinE - mappingFunction(sinE, a_ht, b_ht, c_ht)) * heightCorrection;
+      pWet[i]   = mappingFunction(sinE, c.aw, bw_, cw_);
+      pDelay[i] = pHydro[i]*c.zhd + pWet[i]*c.zwd + (mfgh*c.gnh + mfgw*c.gnw) * cosA + (mfgh*c.geh + mfgw*c.gew) * sinA;
+      pDx[i]    = mfgh * cosA;
+      pDy[i]    = mfgh * sinA;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void TroposphereViennaMapping::getAprioriValues(UInt stationId, const Time &time, Double /*frequency*/, Double &zenithDryDelay, Double &zenithWetDelay,
                                                 Double &gradientDryNorth, Double &gradientWetNorth, Double &gradientDryEast, Double &gradientWetEast,
                                                 Double &aDry, Double &aWet) const
 {
   try
   {
-    UInt   idx;
-    Double tau;
-    findIndex(time, idx, tau);
-
-    aDry             = (1-tau) * ah (idx, stationId) + tau * ah (idx+1, stationId);
-    aWet             = (1-tau) * aw (idx, stationId) + tau * aw (idx+1, stationId);
-    zenithDryDelay   = (1-tau) * zhd(idx, stationId) + tau * zhd(idx+1, stationId);
-    zenithWetDelay   = (1-tau) * zwd(idx, stationId) + tau * zwd(idx+1, stationId);
-    gradientDryNorth = (1-tau) * gnh(idx, stationId) + tau * gnh(idx+1, stationId);
-    gradientWetNorth = (1-tau) * gnw(idx, stationId) + tau * gnw(idx+1, stationId);
-    gradientDryEast  = (1-tau) * geh(idx, stationId) + tau * geh(idx+1, stationId);
-    gradientWetEast  = (1-tau) * gew(idx, stationId) + tau * gew(idx+1, stationId);
+    const Coefficients &c = coefficients(stationId, time);
+    aDry             = c.ah;
+    aWet             = c.aw;
+    zenithDryDelay   = c.zhd;
+    zenithWetDelay   = c.zwd;
+    gradientDryNorth = c.gnh;
+    gradientWetNorth = c.gnw;
+    gradientDryEast  = c.geh;
+    gradientWetEast  = c.gew;
   }
   catch(std::exception &e)
   {
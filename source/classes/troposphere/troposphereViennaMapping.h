@@ -49,7 +49,17 @@ class TroposphereViennaMapping : public Troposphere
   Double                sampling;
   Matrix                ah, aw, zhd, zwd, gnh, geh, gnw, gew;
 
+  // coefficients interpolated to the last requested epoch of each station
+  struct Coefficients
+  {
+    Bool   isValid;
+    Time   time;
+    Double ah, aw, zhd, zwd, gnh, geh, gnw, gew;
+  };
+  mutable std::vector<Coefficients> cache;
+
   void findIndex(const Time &time, UInt &idx, Double &tau) const;
+  const Coefficients &coefficients(UInt stationId, const Time &time) const;
 
 public:
   TroposphereViennaMapping(Config &config);
@@ -60,6 +70,8 @@ public:
   Double mappingFunctionHydrostatic(UInt stationId, const Time &time, Double frequency, Angle azimuth, Angle elevation) const override;
   Double mappingFunctionWet        (UInt stationId, const Time &time, Double frequency, Angle azimuth, Angle elevation) const override;
   void   mappingFunctionGradient   (UInt stationId, const Time &time, Double frequency, Angle azimuth, Angle elevation, Double &dx, Double &dy) const override;
+  void   mappingFunctions          (UInt stationId, const Time &time, Double frequency, const Vector &azimuth, const Vector &elevation,
+                                    Vector &delay, Vector &mfHydrostatic, Vector &mfWet, Vector &dx, Vector &dy) const override;
   void   getAprioriValues          (UInt stationId, const Time &time, Double frequency, Double &zenithDryDelay, Double &zenithWetDelay, Double &gradientDryNorth,
                                     Double &gradientWetNorth, Double &gradientDryEast, Double &gradientWetEast, Double &aDry, Double &aWet) const override;
 };
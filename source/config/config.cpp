@@ -18,6 +18,7 @@
 #include "parser/xml.h"
 #include "parser/stringParser.h"
 #include "parser/expressionParser.h"
+#include "inputOutput/profiler.h"
 #include "parallel/parallel.h"
 #include "classes/condition/condition.h"
 #include "classes/loop/loop.h"
@@ -684,6 +685,37 @@ XmlNodePtr Config::table()
 /***********************************************/
 /***********************************************/
 
+std::string ProgramConfig::comment(Config &config)
+{
+  try
+  {
+    std::string comment;
+    StackNode top = config.stack.top();
+    config.stack.pop(); // coment is given in <program> not in <choiceElement>
+    XmlAttrPtr attr = config.stack.top().xmlNode->getAttribute("comment");
+    if(attr)
+      comment = attr->getText();
+    config.stack.push(top);
+
+    if(!comment.empty())
+    {
+      try
+      {
+        Bool resolved = TRUE;
+        comment = StringParser::parse("comment", comment, config.getVarList(), resolved);
+      }
+      catch(std::exception &/*e*/) {}
+    }
+    return comment;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void ProgramConfig::run(VariableList &variableList, Parallel::CommunicatorPtr comm) const
 {
   try
@@ -700,28 +732,16 @@ void ProgramConfig::run(VariableList &variableList, Parallel::CommunicatorPtr co
       for(auto &program : Program::Program::programList())
         if(readConfigChoiceElement(config, program->name(), type, ""))
         {
-          std::string comment;
-          StackNode top = config.stack.top();
-          config.stack.pop(); // coment is given in <program> not in <choiceElement>
-          XmlAttrPtr attr = config.stack.top().xmlNode->getAttribute("comment");
-          if(attr)
-            comment = attr->getText();
-          config.stack.push(top);
-
+          const std::string comment = ProgramConfig::comment(config);
           Parallel::barrier(comm);
           if(comment.empty())
             logStatus<<"--- "<<program->name()<<" ---"<<Log::endl;
           else
-          {
-            try
-            {
-              Bool resolved = TRUE;
-              comment = StringParser::parse("comment", comment, config.getVarList(), resolved);
-            }
-            catch(std::exception &/*e*/) {}
             logStatus<<"--- "<<program->name()<<" ("<<comment<<") ---"<<Log::endl;
+          {
+            Profiler::Scope scope(program->name());
+            program->run(config, comm);
           }
-          program->run(config, comm);
           Parallel::barrier(comm);
           break;
         }
@@ -735,6 +755,160 @@ void ProgramConfig::run(VariableList &variableList, Parallel::CommunicatorPtr co
   }
 }
 
+/***********************************************/
+
+Bool ProgramConfig::steps(VariableList &variableList, std::vector<Step> &steps) const
+{
+  try
+  {
+    steps.clear();
+    for(auto &xmlNode : stack.top().xmlNode->getChildren())
+      if(xmlNode->findAttribute("loop") || xmlNode->findAttribute("condition"))
+        return FALSE;
+
+    Config config;
+    const std::string name = copy(config, variableList);
+
+    std::string type;
+    while(readConfigChoice(config, name, type, OPTIONAL, "", ""))
+    {
+      for(auto &renamed : Program::RenamedProgram::renamedList())
+        renameDeprecatedChoice(config, type, renamed.oldName, renamed.newName, renamed.time);
+
+      for(auto &program : Program::Program::programList())
+        if(readConfigChoiceElement(config, program->name(), type, ""))
+        {
+          Step step;
+          step.program   = program;
+          step.comment   = ProgramConfig::comment(config);
+          step.config    = std::make_shared<Config>();
+          step.isBarrier = FALSE;
+          config.copy(*step.config, VariableList());
+
+          const auto tags = program->tags();
+          if(std::find(tags.begin(), tags.end(), Program::System) != tags.end())
+            step.isBarrier = TRUE;
+
+          // collect names of input and output files
+          std::function<void(XmlNodePtr, VariableList)> collect = [&](XmlNodePtr xmlNode, VariableList varList)
+          {
+            for(auto &child : xmlNode->getChildren())
+            {
+              XmlAttrPtr label = child->findAttribute("label");
+              XmlAttrPtr link  = child->findAttribute("link");
+              if(label) // local variable
+              {
+                if(!child->hasChildren())
+                  varList.setVariable(label->getText(), (link) ? "{"+link->getText()+"}" : child->getText());
+                continue;
+              }
+              if(child->getName() == "program")
+                step.isBarrier = TRUE;
+              XmlNodePtr node = child;
+              if(link)
+              {
+                auto iter = config.stack.top().links.find(link->getText());
+                if(iter == config.stack.top().links.end())
+                {
+                  step.isBarrier = TRUE;
+                  continue;
+                }
+                node = iter->second;
+              }
+              if(node->hasChildren())
+              {
+                collect(node, varList);
+                continue;
+              }
+
+              const Bool isInput  = (child->getName().find("inputfile")  == 0);
+              const Bool isOutput = (child->getName().find("outputfile") == 0);
+              if(!isInput && !isOutput)
+                continue;
+              Step::File file;
+              file.isOutput = isOutput;
+              file.isPrefix = FALSE;
+              try
+              {
+                Bool resolved = TRUE;
+                file.name = StringParser::parse(child->getName(), (node->findAttribute("link") ? "{"+node->findAttribute("link")->getText()+"}" : node->getText()), varList, resolved);
+                if(!resolved)
+                {
+                  file.name     = file.name.substr(0, file.name.find('{'));
+                  file.isPrefix = TRUE;
+                }
+              }
+              catch(std::exception &/*e*/)
+              {
+                file.name     = "";
+                file.isPrefix = TRUE;
+              }
+              if(!file.name.empty() || file.isPrefix)
+                step.files.push_back(file);
+            }
+          };
+          collect(config.stack.top().xmlNode, config.getVarList());
+
+          // remove the elements, the program is executed later with the copy
+          while(config.stack.top().xmlNode->hasChildren())
+            config.stack.top().xmlNode->getNextChild();
+          steps.push_back(step);
+          break;
+        }
+
+      endChoice(config);
+    }
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void ProgramConfig::run(Step &step, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    if(step.comment.empty())
+      logStatus<<"--- "<<step.program->name()<<" ---"<<Log::endl;
+    else
+      logStatus<<"--- "<<step.program->name()<<" ("<<step.comment<<") ---"<<Log::endl;
+    {
+      Profiler::Scope scope(step.program->name());
+      step.program->run(*step.config, comm);
+    }
+    step.config->notEmptyWarning();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool ProgramConfig::Step::dependsOn(const Step &step) const
+{
+  if(isBarrier || step.isBarrier)
+    return TRUE;
+
+  // file a contains file b (equal, a is a directory of b, or a is a prefix of b)
+  auto contains = [](const File &a, const File &b)
+  {
+    return (b.name.compare(0, a.name.size(), a.name) == 0) &&
+           (a.isPrefix || (b.name.size() == a.name.size()) || (b.name.at(a.name.size()) == '/'));
+  };
+
+  for(const File &a : files)
+    for(const File &b : step.files)
+      if((a.isOutput || b.isOutput) && (contains(a, b) || contains(b, a)))
+        return TRUE;
+  return FALSE;
+}
+
 /***********************************************/
 /*** Functions *********************************/
 /***********************************************/
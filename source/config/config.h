@@ -27,6 +27,8 @@
 class Loop;
 typedef std::shared_ptr<Loop> LoopPtr;
 
+namespace Program {class Program;}
+
 /***** CLASS ***********************************/
 
 /** @brief Read a configuration file or writes the configuration options in a XSD-Schema. */
@@ -147,7 +149,41 @@ public:
 class ProgramConfig : public Config
 {
 public:
+  /** @brief A single program of the list with its own config. */
+  class Step
+  {
+  public:
+    /** @brief File of an inputfile* or outputfile* element. */
+    class File
+    {
+    public:
+      std::string name;
+      Bool        isOutput;
+      Bool        isPrefix; //!< name contains variables not known in advance: all files starting with name
+    };
+
+    Program::Program        *program;
+    std::string              comment;
+    std::shared_ptr<Config>  config;
+    std::vector<File>        files;
+    Bool                     isBarrier; //!< files not known or system program (e.g. nested program lists)
+
+    /** @brief Must be executed after @p step (same file accessed and at least once written). */
+    Bool dependsOn(const Step &step) const;
+  };
+
   void run(VariableList &variableList, Parallel::CommunicatorPtr comm) const;
+
+  /** @brief Evaluate the list of programs in advance.
+  * Returns FALSE if loops or conditions are given at program level,
+  * as these may depend on the results of previous programs. */
+  Bool steps(VariableList &variableList, std::vector<Step> &steps) const;
+
+  /** @brief Execute a single program. */
+  static void run(Step &step, Parallel::CommunicatorPtr comm);
+
+private:
+  static std::string comment(Config &config);
 };
 
 /***** FUNCTIONS ***********************************/
@@ -15,6 +15,7 @@
 #include "base/import.h"
 #include "base/doodson.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileDoodsonHarmonic.h"
 
@@ -89,8 +90,12 @@ void readFileDoodsonHarmonic(const FileName &fileName, DoodsonHarmonic &x)
 {
   try
   {
+    if(FileCache::get(fileName, x))
+      return;
+
     InFileArchive file(fileName, FILE_DOODSONHARMONIC_TYPE, FILE_DOODSONHARMONIC_VERSION);
     file>>nameValue("doodsonHarmonic", x);
+    FileCache::insert(fileName, x);
   }
   catch(std::exception &e)
   {
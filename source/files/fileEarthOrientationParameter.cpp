@@ -14,6 +14,7 @@
 
 #include "base/import.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileEarthOrientationParameter.h"
 
@@ -54,6 +55,9 @@ void readFileEarthOrientationParameter(const FileName &fileName, Matrix &EOP)
 {
   try
   {
+    if(FileCache::get(fileName, EOP))
+      return;
+
     InFileArchive file(fileName, FILE_EARTHORIENTATIONPARAMETER_TYPE, FILE_EARTHORIENTATIONPARAMETER_VERSION);
     UInt count;
     file>>nameValue("count", count);
@@ -70,6 +74,7 @@ void readFileEarthOrientationParameter(const FileName &fileName, Matrix &EOP)
       file>>nameValue("dY",      EOP(i,6));
       file>>endGroup("eop");
     }
+    FileCache::insert(fileName, EOP);
   }
   catch(std::exception &e)
   {
@@ -16,6 +16,7 @@
 #include "base/import.h"
 #include "base/gnssType.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/fileCache.h"
 #include "inputOutput/logging.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileGnssAntennaDefinition.h"
@@ -295,6 +296,16 @@ void readFileGnssAntennaDefinition(const FileName &fileName, std::vector<GnssAnt
 {
   try
   {
+    // cache stores values as the antennas might be modified by the caller
+    std::vector<GnssAntennaDefinition> antennas;
+    if(FileCache::get(fileName, antennas))
+    {
+      x.resize(antennas.size());
+      for(UInt i=0; i<x.size(); i++)
+        x.at(i) = std::make_shared<GnssAntennaDefinition>(antennas.at(i));
+      return;
+    }
+
     InFileArchive file(fileName, FILE_GNSSANTENNADEFINITION_TYPE, FILE_GNSSANTENNADEFINITION_VERSION);
     if(file.version() < 20190304)
       throw(Exception(fileName.str()+": old GnssAntennaDefinition file, definition of reference frames changed"));
@@ -304,6 +315,14 @@ void readFileGnssAntennaDefinition(const FileName &fileName, std::vector<GnssAnt
     x.resize(count);
     for(UInt i=0; i<x.size(); i++)
       file>>nameValue("antenna", x.at(i));
+
+    if(FileCache::maxSize())
+    {
+      antennas.reserve(x.size());
+      for(UInt i=0; i<x.size(); i++)
+        antennas.push_back(*x.at(i));
+      FileCache::insert(fileName, antennas);
+    }
   }
   catch(std::exception &e)
   {
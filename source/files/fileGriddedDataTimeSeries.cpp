@@ -23,32 +23,15 @@ GROOPS_REGISTER_FILEFORMAT(GriddedDataTimeSeries, FILE_GRIDDEDDATATIMESERIES_TYP
 
 /***********************************************/
 
-void InFileGriddedDataTimeSeries::open(const FileName &name)
+void InFileGriddedDataTimeSeries::open(const FileName &name, UInt nodeCountInMemory)
 {
   try
   {
     close();
     if(!name.empty())
     {
-      UInt epochCount;
-
-      file.open(name, FILE_GRIDDEDDATATIMESERIES_TYPE, FILE_GRIDDEDDATATIMESERIES_VERSION);
-      file>>nameValue("splineDegree", splineDegree_);
-      file>>nameValue("timeCount",    epochCount);
-      file>>nameValue("dataCount",    dataCount_);
-      file>>nameValue("grid",         grid_);
-      times_.resize(epochCount);
-      for(UInt i=0; i<times_.size(); i++)
-        file>>nameValue("time", times_.at(i));
-
-      // If we have a binary file, we can efficiently seek to the needed position in the file.
-      if(file.canSeek())
-        seekStart = file.position();
-      seekSize = 0;
-
-      indexFile = 0;
-      indexData = nodeCount();
-      data_.resize(splineDegree_+1);
+      readHeader(name);
+      cacheSize = std::max(nodeCountInMemory, splineDegree_+1);
     }
   }
   catch(std::exception &e)
@@ -57,6 +40,33 @@ void InFileGriddedDataTimeSeries::open(const FileName &name)
   }
 }
 
+/***********************************************/
+
+void InFileGriddedDataTimeSeries::readHeader(const FileName &name)
+{
+  try
+  {
+    UInt epochCount;
+    file.open(name, FILE_GRIDDEDDATATIMESERIES_TYPE, FILE_GRIDDEDDATATIMESERIES_VERSION);
+    file>>nameValue("splineDegree", splineDegree_);
+    file>>nameValue("timeCount",    epochCount);
+    file>>nameValue("dataCount",    dataCount_);
+    file>>nameValue("grid",         grid_);
+    times_.resize(epochCount);
+    for(UInt i=0; i<times_.size(); i++)
+      file>>nameValue("time", times_.at(i));
+
+    // If we have a binary file, we can efficiently seek to the needed position in the file.
+    if(file.canSeek())
+      seekStart = file.position();
+    seekSize = 0;
+    indexFile = 0;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
 /***********************************************/
 
@@ -65,26 +75,24 @@ void InFileGriddedDataTimeSeries::close()
   file.close();
   grid_ = GriddedData();
   times_.clear();
+  cache.clear();
   dataCount_    = 0;
   splineDegree_ = 0;
 }
 
 /***********************************************/
 
-Matrix InFileGriddedDataTimeSeries::data(UInt idNode) // points x data columns
+Matrix InFileGriddedDataTimeSeries::readNode(UInt idNode) // points x data columns
 {
   try
   {
-    if(file.fileName().empty())
-      throw(Exception("no file open"));
-
     // must restart?
     if(indexFile > idNode)
     {
       if(file.canSeek() && seekSize)
         indexFile = 0;
       else
-        open(file.fileName());
+        readHeader(file.fileName()); // reopen keeps cached nodes
     }
 
     Matrix data(grid_.points.size(), dataCount_);
@@ -122,6 +130,47 @@ Matrix InFileGriddedDataTimeSeries::data(UInt idNode) // points x data columns
 
 /***********************************************/
 
+const Matrix &InFileGriddedDataTimeSeries::node(UInt idNode)
+{
+  try
+  {
+    if(file.fileName().empty())
+      throw(Exception("no file open"));
+
+    auto iter = std::find_if(cache.begin(), cache.end(), [&](const auto &x) {return x.first == idNode;});
+    if(iter == cache.end())
+    {
+      Matrix data = readNode(idNode);
+      if(cache.size() >= cacheSize)
+        cache.pop_back(); // drop least recently used node
+      cache.emplace_front(idNode, std::move(data));
+      return cache.front().second;
+    }
+    cache.splice(cache.begin(), cache, iter); // move to front
+    return cache.front().second;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix InFileGriddedDataTimeSeries::data(UInt idNode) // points x data columns
+{
+  try
+  {
+    return node(idNode);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Matrix InFileGriddedDataTimeSeries::data(const Time &time)
 {
   try
@@ -131,20 +180,13 @@ Matrix InFileGriddedDataTimeSeries::data(const Time &time)
     if((time < times_.front()) || (time > times_.back()))
       throw(Exception(time.dateTimeStr()+" outside interval ["+times_.front().dateTimeStr()+", "+times_.back().dateTimeStr()+"] of <"+file.fileName().str()+">"));
 
-    // find time interval and read missing nodes
-    const UInt idx   = std::min(static_cast<UInt>(std::distance(times_.begin(), std::upper_bound(times_.begin(), times_.end(), time))), times_.size()-1)-1;
-    const UInt start = (idx > indexData) ? std::max(idx, indexData+data_.size()) : idx;
-    const UInt end   = (idx > indexData) ? idx+data_.size() : std::min(idx+data_.size(), indexData);
-    for(UInt i=start; i<end; i++)
-      data_.at(i%data_.size()) = data(i);
-    indexData = idx;
-
-    // spline interploation in interval
+    // find time interval, only the support of the spline is needed
+    const UInt   idx   = std::min(static_cast<UInt>(std::distance(times_.begin(), std::upper_bound(times_.begin(), times_.end(), time))), times_.size()-1)-1;
     const Double t     = (time-times_.at(idx)).mjd()/(times_.at(idx+1)-times_.at(idx)).mjd();
     const Vector coeff = BasisSplines::compute(t, splineDegree_);
-    Matrix data = coeff(0) * data_.at(indexData%data_.size());
+    Matrix data = coeff(0) * node(idx);
     for(UInt i=1; i<coeff.rows(); i++)
-      axpy(coeff(i), data_.at((indexData+i)%data_.size()), data);
+      axpy(coeff(i), node(idx+i), data);
     return data;
   }
   catch(std::exception &e)
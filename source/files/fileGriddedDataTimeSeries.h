@@ -29,6 +29,7 @@ specific time stamp to obtain a \file{griddedData}{griddedData} with \program{Gr
 
 /***********************************************/
 
+#include <list>
 #include "base/exception.h"
 #include "base/griddedData.h"
 #include "inputOutput/fileName.h"
@@ -51,17 +52,24 @@ class InFileGriddedDataTimeSeries
   UInt                splineDegree_, dataCount_;
   GriddedData         grid_;
   std::vector<Time>   times_;
-  UInt                indexFile, indexData;
+  UInt                indexFile, cacheSize;
   std::streampos      seekStart;
   std::streamoff      seekSize;
-  std::vector<Matrix> data_;
+  std::list<std::pair<UInt, Matrix>> cache; // most recently used nodes first
+
+  void          readHeader(const FileName &name);
+  Matrix        readNode(UInt idNode);
+  const Matrix &node(UInt idNode);
 
 public:
-  InFileGriddedDataTimeSeries() : splineDegree_(0), dataCount_(0) {}
-  InFileGriddedDataTimeSeries(const FileName &name) {open(name);}
+  InFileGriddedDataTimeSeries() : splineDegree_(0), dataCount_(0), cacheSize(0) {}
+  InFileGriddedDataTimeSeries(const FileName &name, UInt nodeCountInMemory=0) {open(name, nodeCountInMemory);}
  ~InFileGriddedDataTimeSeries() {close();}
 
-  void open(const FileName &name);
+  /** @brief Open file and read the header only.
+  * The nodal points are read on demand. At most @p nodeCountInMemory nodes (at least splineDegree+1)
+  * are kept in memory, the least recently used node is dropped first. */
+  void open(const FileName &name, UInt nodeCountInMemory=0);
   void close();
 
   UInt splineDegree() const {return splineDegree_;}
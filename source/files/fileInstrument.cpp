@@ -18,6 +18,10 @@
 #include "files/fileFormatRegister.h"
 #include "files/fileMatrix.h"
 #include "files/fileInstrument.h"
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 GROOPS_REGISTER_FILEFORMAT(Instrument, FILE_INSTRUMENT_TYPE)
 
@@ -392,24 +396,33 @@ void Arc::synchronize(const std::vector<Time> &time, Double margin)
 {
   try
   {
-    if(size() == 0)
+    if((size() == 0) || (time.size() == 0))
+    {
+      epoch.clear();
       return;
-    UInt idxT=0, idxE=0, idxW = 0;
-    for(;;)
+    }
+
+    // integer nanoseconds relative to first epoch -> merge without time arithmetic
+    const Time  timeRef   = epoch.front()->time;
+    const Int64 marginNs  = static_cast<Int64>(std::llround(1e9*margin));
+    auto        toNs      = [&](const Time &t) {return static_cast<Int64>(std::llround(1e9*(t-timeRef).seconds()));};
+
+    UInt  idxT = 0, idxW = 0;
+    Int64 timeNs = toNs(time.at(idxT));
+    for(UInt idxE=0; idxE<epoch.size(); idxE++)
     {
-      if(idxE>=epoch.size())
-        break;
-      while((idxT<time.size())  && ((time.at(idxT)-epoch.at(idxE)->time).seconds() < -margin))
-        idxT++;
-      if(idxT>=time.size())
-        break;
-      while((idxE<epoch.size()) && ((time.at(idxT)-epoch.at(idxE)->time).seconds() > +margin))
-        idxE++;
-      if(idxE>=epoch.size())
-        break;
-      if(std::fabs((time.at(idxT)-epoch.at(idxE)->time).seconds()) > margin)
-        break;
-      epoch.at(idxW++) = std::move(epoch.at(idxE++));
+      const Int64 epochNs = toNs(epoch.at(idxE)->time);
+      while(timeNs-epochNs < -marginNs)
+      {
+        if(++idxT >= time.size())
+        {
+          epoch.resize(idxW);
+          return;
+        }
+        timeNs = toNs(time.at(idxT));
+      }
+      if(timeNs-epochNs <= marginNs)
+        epoch.at(idxW++) = std::move(epoch.at(idxE));
     }
     epoch.resize(idxW);
   }
@@ -705,6 +718,20 @@ void Arc::save(OutArchive &oa) const
 /***********************************************/
 /***********************************************/
 
+class InstrumentFile::ReadAhead
+{
+public:
+  std::thread                       thread;
+  std::mutex                        mutex;
+  std::condition_variable           condition;
+  std::deque<std::pair<UInt, Arc>>  queue;
+  UInt                              position = 0; // arcs before are not queued anymore
+  Bool                              stop     = FALSE;
+  Bool                              finished = FALSE;
+};
+
+/***********************************************/
+
 void InstrumentFile::open(const FileName &name)
 {
   try
@@ -777,6 +804,7 @@ void InstrumentFile::open(const FileName &name)
 
 void InstrumentFile::close()
 {
+  stopReadAhead();
   if(!fileName.empty())
     file.close();
   fileName  = FileName();
@@ -796,6 +824,47 @@ Arc InstrumentFile::readArc(UInt i)
     if(i>=arcCount_)
       throw(Exception("index >= arcCount"));
 
+    if(readAheadCount && !readAhead && !readAheadArcs.size() && (i >= index) && (file.type() == FILE_INSTRUMENT_TYPE))
+      startReadAhead();
+
+    if(readAhead)
+    {
+      std::unique_lock<std::mutex> lock(readAhead->mutex);
+      for(;;)
+      {
+        auto &queue = readAhead->queue;
+        while(queue.size() && (queue.front().first < i))
+          queue.pop_front();
+        readAhead->condition.notify_all();
+        if(queue.size() && (queue.front().first == i))
+        {
+          Arc arc = std::move(queue.front().second);
+          queue.pop_front();
+          readAhead->condition.notify_all();
+          return arc;
+        }
+        if(queue.size() || readAhead->finished || (i < readAhead->position) || (readAheadArcs.size() && !readAheadArcs.at(i)))
+          break; // not queued -> synchronous reading
+        readAhead->condition.wait(lock);
+      }
+      lock.unlock();
+      stopReadAhead();
+    }
+
+    return readArcSequential(i);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Arc InstrumentFile::readArcSequential(UInt i)
+{
+  try
+  {
     // behind arc in file -> restart at beginning
     if(i<index)
       open(FileName(fileName));
@@ -837,6 +906,241 @@ Arc InstrumentFile::readArc(UInt i)
 
 /***********************************************/
 
+void InstrumentFile::setReadAhead(UInt count)
+{
+  stopReadAhead();
+  readAheadCount = count;
+  readAheadLast  = NULLINDEX;
+  readAheadArcs.clear();
+}
+
+/***********************************************/
+
+void InstrumentFile::prefetchArc(UInt arcNo)
+{
+  try
+  {
+    if(!readAheadCount || fileName.empty() || (arcNo >= arcCount_) || (file.type() != FILE_INSTRUMENT_TYPE))
+      return;
+    if(readAhead && readAhead->finished)
+      stopReadAhead();
+
+    {
+      std::unique_lock<std::mutex> lock;
+      if(readAhead)
+        lock = std::unique_lock<std::mutex>(readAhead->mutex);
+      if(readAheadArcs.size() != arcCount_)
+        readAheadArcs.assign(arcCount_, FALSE);
+      readAheadArcs.at(arcNo) = TRUE;
+      if((readAheadLast == NULLINDEX) || (readAheadLast < arcNo))
+        readAheadLast = arcNo;
+      if(readAhead)
+        readAhead->condition.notify_all();
+    }
+
+    if(!readAhead && (arcNo >= index))
+      startReadAhead();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::startReadAhead()
+{
+  readAhead = std::make_shared<ReadAhead>();
+  readAhead->position = index;
+  // the background thread owns the file (and index) until stopReadAhead() is called
+  readAhead->thread = std::thread([this, state=readAhead.get()]()
+  {
+    try
+    {
+      for(UInt arcNo=index; arcNo<arcCount_; arcNo++)
+      {
+        Bool selected;
+        {
+          std::unique_lock<std::mutex> lock(state->mutex);
+          // announced arcs only: decode up to the last announced arc
+          state->condition.wait(lock, [&]{return state->stop || !readAheadArcs.size() || ((readAheadLast != NULLINDEX) && (readAheadLast >= arcNo));});
+          selected = !readAheadArcs.size() || readAheadArcs.at(arcNo);
+          if(selected)
+            state->condition.wait(lock, [&]{return state->stop || (state->queue.size() < readAheadCount);});
+          if(state->stop)
+            break;
+        }
+        Arc arc = readArcSequential(arcNo);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if(selected)
+          state->queue.emplace_back(arcNo, std::move(arc));
+        state->position = arcNo+1;
+        state->condition.notify_all();
+      }
+    }
+    catch(std::exception &/*e*/)
+    {
+      // file position is undefined -> force reopening, errors are reported by synchronous reading
+      index = arcCount_;
+    }
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->finished = TRUE;
+    state->condition.notify_all();
+  });
+}
+
+/***********************************************/
+
+void InstrumentFile::stopReadAhead()
+{
+  if(!readAhead)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(readAhead->mutex);
+    readAhead->stop = TRUE;
+    readAhead->condition.notify_all();
+  }
+  readAhead->thread.join();
+  readAhead = nullptr;
+}
+
+/***********************************************/
+/***********************************************/
+
+class InstrumentFile::AsyncWriter::State
+{
+public:
+  const std::vector<Arc>  &arcList;
+  std::thread              thread;
+  std::mutex               mutex;
+  std::condition_variable  condition;
+  std::vector<Bool>        ready;
+  UInt                     readyCount = 0; // arcs ready without gap from the beginning
+  Bool                     stop       = FALSE;
+  std::exception_ptr       error;
+
+  explicit State(const std::vector<Arc> &arcList) : arcList(arcList), ready(arcList.size(), FALSE) {}
+
+  // returns FALSE if stopped
+  Bool waitReady(UInt count)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [&]{return stop || (readyCount >= count);});
+    return !stop;
+  }
+};
+
+/***********************************************/
+
+InstrumentFile::AsyncWriter::AsyncWriter(const FileName &name, const std::vector<Arc> &arcList)
+{
+  if(name.empty())
+    return;
+  state = std::make_shared<State>(arcList);
+  state->thread = std::thread([name, state=state.get()]()
+  {
+    try
+    {
+      const std::vector<Arc> &arcList = state->arcList;
+
+      // instrument type from first non-empty arc
+      UInt idType = 0;
+      for(; idType<arcList.size(); idType++)
+      {
+        if(!state->waitReady(idType+1))
+          return;
+        if(arcList.at(idType).size())
+          break;
+      }
+      const Epoch::Type type = (idType < arcList.size()) ? arcList.at(idType).getType() : Epoch::EMPTY;
+
+      OutFileArchive file(name, FILE_INSTRUMENT_TYPE, FILE_INSTRUMENT_VERSION);
+      file.comment(Epoch::getTypeName(type));
+      file<<nameValue("satelliteType", static_cast<Int>(type));
+      file<<nameValue("arcCount",      arcList.size());
+      const std::string comment = Epoch::fileFormatString(type);
+      file.comment(comment);
+      file.comment(std::string(comment.size(), '='));
+      for(UInt arcNo=0; arcNo<arcList.size(); arcNo++)
+      {
+        if(!state->waitReady(arcNo+1))
+          return;
+        const Arc &arc = arcList.at(arcNo);
+        if(arc.size() && (arc.getType() != type))
+          throw(Exception("arcList contain different instruments types "+Epoch::getTypeName(type)+", "+arc.getTypeName()));
+        file<<beginGroup("arc");
+        file<<nameValue("pointCount", arc.size());
+        for(UInt i=0; i<arc.size(); i++)
+        {
+          file<<beginGroup("epoch");
+          arc.at(i).save(file.outArchive());
+          file<<endGroup("epoch");
+        }
+        file<<endGroup("arc");
+      }
+    }
+    catch(...)
+    {
+      state->error = std::current_exception();
+    }
+  });
+}
+
+/***********************************************/
+
+InstrumentFile::AsyncWriter::~AsyncWriter()
+{
+  if(!state)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->stop = TRUE;
+    state->condition.notify_all();
+  }
+  state->thread.join();
+}
+
+/***********************************************/
+
+void InstrumentFile::AsyncWriter::setReady(UInt arcNo)
+{
+  if(!state)
+    return;
+  std::lock_guard<std::mutex> lock(state->mutex);
+  state->ready.at(arcNo) = TRUE;
+  while((state->readyCount < state->ready.size()) && state->ready.at(state->readyCount))
+    state->readyCount++;
+  state->condition.notify_all();
+}
+
+/***********************************************/
+
+void InstrumentFile::AsyncWriter::finish()
+{
+  try
+  {
+    if(!state)
+      return;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->readyCount = state->ready.size();
+      state->condition.notify_all();
+    }
+    state->thread.join();
+    auto error = state->error;
+    state = nullptr;
+    if(error)
+      std::rethrow_exception(error);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Arc InstrumentFile::read(const FileName &name)
 {
   try
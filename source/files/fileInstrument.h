@@ -413,15 +413,29 @@ typedef std::shared_ptr<InstrumentFile> InstrumentFilePtr;
 *     logInfo<<arc.at(i).time<<": "<<arc.at(i).range<<Log::endl; // access to Epoch with .at(i)
 * }
 * @endcode
+*
+* With @a setReadAhead the following arcs are decoded in a background thread
+* while the current arc is processed. In a dynamically distributed loop
+* the arcs assigned next to the process are announced with @a prefetchArc.
 */
 class InstrumentFile
 {
+  class ReadAhead;
+
   InFileArchive file;
   FileName      fileName;
   Epoch::Type   type;
   UInt          arcCount_;
   UInt          index;
   Matrix        A; // if a matrix file is open
+  UInt          readAheadCount = 0;
+  UInt          readAheadLast  = NULLINDEX; // last announced arc
+  std::vector<Bool>          readAheadArcs;   // announced arcs
+  std::shared_ptr<ReadAhead> readAhead;
+
+  Arc  readArcSequential(UInt arcNo);
+  void startReadAhead();
+  void stopReadAhead();
 
 public:
   InstrumentFile() : type(Epoch::EMPTY), arcCount_(0) {}       //!< Default constructor.
@@ -456,6 +470,19 @@ public:
   * If the file is not open, a empty Arc is returned. */
   Arc readArc(UInt arcNo);
 
+  /** @brief Decode arcs in a background thread.
+  * After the first call of @a readArc the following arcs are read in a background thread
+  * and at most @p count decoded arcs are kept in a queue. Arcs skipped by @a readArc
+  * are removed from the queue.
+  * A request not in the queue (e.g. backward jump) falls back to synchronous reading.
+  * The setting is kept if the file is reopened, @p count=0 disables the read ahead. */
+  void setReadAhead(UInt count);
+
+  /** @brief Announce an arc to be read soon (e.g. the next arc assigned to this process).
+  * Needs @a setReadAhead. After the first call only announced arcs are queued
+  * and the background thread decodes the file up to the last announced arc. */
+  void prefetchArc(UInt arcNo);
+
   /** @brief Test number of arcs of multiple files.
   * Test whether files are divided into the same number of arcs otherwise an expection is thrown.
   * Files which are not open are ignored. */
@@ -504,6 +531,29 @@ public:
     }
   }
 
+  /** @brief Write a list of Arc to file in a background thread while the arcs are computed.
+  * Each arc is written as soon as it and all previous arcs are marked with @a setReady,
+  * the instrument type is taken from the first non-empty arc.
+  * Marked arcs must not be changed until @a finish returns.
+  * If the file name is empty nothing is written. */
+  class AsyncWriter
+  {
+    class State;
+    std::shared_ptr<State> state;
+
+  public:
+    AsyncWriter(const FileName &name, const std::vector<Arc> &arcList);
+    AsyncWriter(const AsyncWriter &) = delete;
+    AsyncWriter &operator=(const AsyncWriter &) = delete;
+   ~AsyncWriter(); //!< Stops writing if @a finish is not called (e.g. exception).
+
+    /** @brief Arc @p arcNo is computed and can be written. */
+    void setReady(UInt arcNo);
+
+    /** @brief Marks all arcs as ready, waits until the file is written, and rethrows errors of the background thread. */
+    void finish();
+  };
+
   /** @brief Factory for Instrument file. */
   static InstrumentFilePtr newFile(const std::string &name="") {return std::make_shared<InstrumentFile>(name);}
 };
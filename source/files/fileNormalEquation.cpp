@@ -46,6 +46,11 @@ static void writeInfoFile(const FileName &name, const NormalEquationInfo &info,
       file<<nameValue("blockSize", info.blockIndex.at(i+1)-info.blockIndex.at(i));
 //     file<<nameValue("extension",  name.extension().str());
     file<<nameValue("usedBlocks", info.usedBlocks);
+    if(info.intervalStart.size())
+    {
+      file<<nameValue("intervalStart", info.intervalStart);
+      file<<nameValue("intervalEnd",   info.intervalEnd);
+    }
 
     // parameter name file
     writeFileParameterName(name.replaceFullExtension(".parameterNames.txt"), info.parameterName);
@@ -208,6 +213,17 @@ static void readInfoFile(const FileName &name, NormalEquationInfo &info, Matrix
           info.usedBlocks(i,k) = 1;
     }
 
+    try
+    {
+      file>>nameValue("intervalStart", info.intervalStart);
+      file>>nameValue("intervalEnd",   info.intervalEnd);
+    }
+    catch(std::exception &/*e*/)
+    {
+      info.intervalStart.clear();
+      info.intervalEnd.clear();
+    }
+
     // read parameter name file
     // ------------------------
     info.parameterName.clear();
@@ -311,3 +327,23 @@ void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, Matr
 }
 
 /***********************************************/
+
+void readFileNormalEquation(const FileName &name, const NormalEquationInfo &info, UInt i, UInt k, Matrix &N)
+{
+  try
+  {
+    const UInt blockCount = info.blockIndex.size()-1;
+    N = Matrix();
+    if(info.usedBlocks.size() && (info.usedBlocks(std::min(i,k), std::max(i,k)) <= 0))
+      return;
+    readFileMatrix(name.appendBaseName((blockCount>1) ? "."+i%"%02i-"s+k%"%02i"s : ""s), N);
+    if((N.rows() != info.blockIndex.at(i+1)-info.blockIndex.at(i)) || (N.columns() != info.blockIndex.at(k+1)-info.blockIndex.at(k)))
+      throw(Exception("<"+name.str()+"> block ("+i%"%i, "s+k%"%i): dimension error"s));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -30,7 +30,8 @@ The file name \verb|normals.dat.gz| corresponds to the following files:
       the right hand side(s) $\M n$ as \file{matrix}{matrix},
 \item \verb|normals.parameterNames.txt|: \file{parameter names}{parameterName},
 \item \verb|normals.info.xml|:
-\     u.a. containing the number of observations and the quadratic sum of (reduced) observations $\M l^T\M P\M l$.
+\     u.a. containing the number of observations and the quadratic sum of (reduced) observations $\M l^T\M P\M l$,
+      optionally the time intervals contained in accumulated normals (see \program{NormalsAccumulate}).
 \end{itemize}
 A large normal matrix may be splitted into blocks and stored in multiple files.
 The block row/column number is indicated in the file name.
@@ -64,6 +65,7 @@ public:
   UInt observationCount;
   std::vector<UInt> blockIndex;
   Matrix usedBlocks;
+  std::vector<Time> intervalStart, intervalEnd; // time intervals contained in accumulated normals (e.g. rolling windows), optional
 
   NormalEquationInfo(UInt rhsCount = 1) : lPl(rhsCount), observationCount(0) {}
   NormalEquationInfo(const std::vector<ParameterName> &parameterName_, const Vector &lPl_ = Vector(1), UInt observationCount_ = 0)
@@ -101,6 +103,11 @@ void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, Matr
 * Only the information file, parameter name file and the right hand sides are read. */
 void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, Matrix &n);
 
+/** @brief Read the block (@a i, @a k) of the normal matrix.
+* The info must be read before (e.g. with @a readFileNormalEquation(name, info, n)).
+* Unused blocks are returned as empty matrix. */
+void readFileNormalEquation(const FileName &name, const NormalEquationInfo &info, UInt i, UInt k, Matrix &N);
+
 /***********************************************/
 
 /// @}
@@ -15,6 +15,7 @@
 #include "base/import.h"
 #include "base/sphericalHarmonics.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileSphericalHarmonics.h"
 
@@ -41,8 +42,12 @@ void readFileSphericalHarmonics(const FileName &fileName, SphericalHarmonics &x)
 {
   try
   {
+    if(FileCache::get(fileName, x))
+      return;
+
     InFileArchive file(fileName, FILE_POTENTIALCOEFFICIENTS_TYPE, FILE_POTENTIALCOEFFICIENTS_VERSION);
     file>>nameValue("potentialCoefficients", x);
+    FileCache::insert(fileName, x);
   }
   catch(std::exception &e)
   {
@@ -15,6 +15,7 @@
 #include "base/import.h"
 #include "base/tideGeneratingPotential.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileTideGeneratingPotential.h"
 
@@ -87,8 +88,12 @@ void readFileTideGeneratingPotential(const FileName &fileName, TideGeneratingPot
 {
   try
   {
+    if(FileCache::get(fileName, x))
+      return;
+
     InFileArchive file(fileName, FILE_TIDEGENERATINGPOTENTIAL_TYPE, FILE_TIDEGENERATINGPOTENTIAL_VERSION);
     file>>nameValue("tideGeneratingPotential", x);
+    FileCache::insert(fileName, x);
   }
   catch(std::exception &e)
   {
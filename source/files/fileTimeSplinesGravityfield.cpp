@@ -26,35 +26,46 @@ GROOPS_REGISTER_FILEFORMAT(TimeSplinesCovariance,   FILE_TIMESPLINESCOVARIANCE_T
 
 /***** FUNCTIONS *******************************/
 
-void InFileTimeSplinesGravityfield::open(const FileName &name, UInt maxDegree, UInt minDegree)
+void InFileTimeSplinesGravityfield::open(const FileName &name, UInt maxDegree, UInt minDegree, UInt nodeCountInMemory)
 {
   try
   {
+    close();
     maxDegree_ = maxDegree;
     minDegree_ = minDegree;
-
-    close();
     if(!name.empty())
     {
-      UInt epochCount;
-      file.open(name, FILE_TIMESPLINESGRAVITYFIELD_TYPE, FILE_TIMESPLINESGRAVITYFIELD_VERSION);
-      file>>nameValue("GM",        GM);
-      file>>nameValue("R",         R);
-      file>>nameValue("degree",    splineDegree_);
-      file>>nameValue("timeCount", epochCount);
-      times_.resize(epochCount);
-      for(UInt i=0; i<times_.size(); i++)
-        file>>nameValue("time", times_.at(i));
+      readHeader(name);
+      cacheSize = std::max(nodeCountInMemory, splineDegree_+1);
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-      // If we have a binary file, we can efficiently seek to the needed position in the file.
-      if(file.canSeek())
-        seekStart = file.position();
-      seekSize = 0;
+/***********************************************/
 
-      indexFile = 0;
-      indexData = nodeCount();
-      harmonics.resize(splineDegree_+1);
-    }
+void InFileTimeSplinesGravityfield::readHeader(const FileName &name)
+{
+  try
+  {
+    UInt epochCount;
+    file.open(name, FILE_TIMESPLINESGRAVITYFIELD_TYPE, FILE_TIMESPLINESGRAVITYFIELD_VERSION);
+    file>>nameValue("GM",        GM);
+    file>>nameValue("R",         R);
+    file>>nameValue("degree",    splineDegree_);
+    file>>nameValue("timeCount", epochCount);
+    times_.resize(epochCount);
+    for(UInt i=0; i<times_.size(); i++)
+      file>>nameValue("time", times_.at(i));
+
+    // If we have a binary file, we can efficiently seek to the needed position in the file.
+    if(file.canSeek())
+      seekStart = file.position();
+    seekSize = 0;
+    indexFile = 0;
   }
   catch(std::exception &e)
   {
@@ -68,25 +79,23 @@ void InFileTimeSplinesGravityfield::close()
 {
   file.close();
   times_.clear();
+  cache.clear();
   splineDegree_ = 0;
 }
 
 /***********************************************/
 
-SphericalHarmonics InFileTimeSplinesGravityfield::sphericalHarmonics(UInt idNode)
+SphericalHarmonics InFileTimeSplinesGravityfield::readNode(UInt idNode)
 {
   try
   {
-    if(file.fileName().empty())
-      throw(Exception("no file open"));
-
     // must restart?
     if(indexFile > idNode)
     {
       if(file.canSeek() && seekSize)
         indexFile = 0;
       else
-        open(file.fileName());
+        readHeader(file.fileName()); // reopen keeps cached nodes
     }
 
     SphericalHarmonics harmonics;
@@ -104,7 +113,8 @@ SphericalHarmonics InFileTimeSplinesGravityfield::sphericalHarmonics(UInt idNode
       file>>nameValue("cnm", cnm);
       file>>nameValue("snm", snm);
       file>>endGroup("node");
-      harmonics = SphericalHarmonics(GM, R, cnm, snm).get(maxDegree_, minDegree_);
+      if(indexFile == idNode)
+        harmonics = SphericalHarmonics(GM, R, cnm, snm).get(maxDegree_, minDegree_);
 
       if(file.canSeek() && (indexFile == 0))
         seekSize = file.position() - seekStart;
@@ -121,29 +131,57 @@ SphericalHarmonics InFileTimeSplinesGravityfield::sphericalHarmonics(UInt idNode
 
 /***********************************************/
 
-SphericalHarmonics InFileTimeSplinesGravityfield::sphericalHarmonics(const Time &time, Double factor)
+const SphericalHarmonics &InFileTimeSplinesGravityfield::node(UInt idNode)
 {
   try
   {
     if(file.fileName().empty())
       throw(Exception("no file open"));
-    if((time < times_.front()) || (time > times_.back()))
-      throw(Exception(time.dateTimeStr()+" outside interval ["+times_.front().dateTimeStr()+", "+times_.back().dateTimeStr()+"] of <"+file.fileName().str()+">"));
 
-    // find time interval and read missing nodes
-    const UInt idx   = std::min(static_cast<UInt>(std::distance(times_.begin(), std::upper_bound(times_.begin(), times_.end(), time))), times_.size()-1)-1;
-    const UInt start = (idx > indexData) ? std::max(idx, indexData+harmonics.size()) : idx;
-    const UInt end   = (idx > indexData) ? idx+harmonics.size() : std::min(idx+harmonics.size(), indexData);
-    for(UInt i=start; i<end; i++)
-      harmonics.at(i%harmonics.size()) = sphericalHarmonics(i);
-    indexData = idx;
+    auto iter = std::find_if(cache.begin(), cache.end(), [&](const auto &x) {return x.first == idNode;});
+    if(iter == cache.end())
+    {
+      SphericalHarmonics harmonics = readNode(idNode);
+      if(cache.size() >= cacheSize)
+        cache.pop_back(); // drop least recently used node
+      cache.emplace_front(idNode, std::move(harmonics));
+      return cache.front().second;
+    }
+    cache.splice(cache.begin(), cache, iter); // move to front
+    return cache.front().second;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-    // spline interpolation in interval
-    const Double       t     = (time-times_.at(idx)).mjd()/(times_.at(idx+1)-times_.at(idx)).mjd();
-    const Vector       coeff = BasisSplines::compute(t, splineDegree_);
-    SphericalHarmonics harm  = factor * coeff(0) * harmonics.at(indexData%harmonics.size());
+/***********************************************/
+
+SphericalHarmonics InFileTimeSplinesGravityfield::sphericalHarmonics(UInt idNode)
+{
+  try
+  {
+    return node(idNode);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+SphericalHarmonics InFileTimeSplinesGravityfield::sphericalHarmonics(const Time &time, Double factor)
+{
+  try
+  {
+    // only the support of the spline is needed
+    Vector             coeff;
+    const UInt         idx  = interval(time, coeff);
+    SphericalHarmonics harm = factor * coeff(0) * node(idx);
     for(UInt i=1; i<coeff.rows(); i++)
-      harm += factor * coeff(i) * harmonics.at((indexData+i)%harmonics.size());
+      harm += factor * coeff(i) * node(idx+i);
     return harm;
   }
   catch(std::exception &e)
@@ -154,6 +192,28 @@ SphericalHarmonics InFileTimeSplinesGravityfield::sphericalHarmonics(const Time
 
 /***********************************************/
 
+UInt InFileTimeSplinesGravityfield::interval(const Time &time, Vector &coeff) const
+{
+  try
+  {
+    if(file.fileName().empty())
+      throw(Exception("no file open"));
+    if((time < times_.front()) || (time > times_.back()))
+      throw(Exception(time.dateTimeStr()+" outside interval ["+times_.front().dateTimeStr()+", "+times_.back().dateTimeStr()+"] of <"+file.fileName().str()+">"));
+
+    const UInt   idx = std::min(static_cast<UInt>(std::distance(times_.begin(), std::upper_bound(times_.begin(), times_.end(), time))), times_.size()-1)-1;
+    const Double t   = (time-times_.at(idx)).mjd()/(times_.at(idx+1)-times_.at(idx)).mjd();
+    coeff = BasisSplines::compute(t, splineDegree_);
+    return idx;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void writeFileTimeSplinesGravityfield(const FileName &fileName,
                                       Double GM, Double R, UInt splineDegree,
                                       const std::vector<Time> &times,
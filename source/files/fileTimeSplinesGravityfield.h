@@ -35,6 +35,7 @@ temporal nodal point.
 
 /***********************************************/
 
+#include <list>
 #include "base/import.h"
 #include "base/sphericalHarmonics.h"
 #include "inputOutput/fileArchive.h"
@@ -59,17 +60,24 @@ class InFileTimeSplinesGravityfield
   std::vector<Time>   times_;
   Double              GM, R;
   UInt                maxDegree_, minDegree_;
-  UInt                indexFile, indexData;
+  UInt                indexFile, cacheSize;
   std::streampos      seekStart;
   std::streamoff      seekSize;
-  std::vector<SphericalHarmonics> harmonics;
+  std::list<std::pair<UInt, SphericalHarmonics>> cache; // most recently used nodes first
+
+  void readHeader(const FileName &name);
+  SphericalHarmonics readNode(UInt idNode);
+  const SphericalHarmonics &node(UInt idNode);
 
 public:
-  InFileTimeSplinesGravityfield() {}
-  InFileTimeSplinesGravityfield(const FileName &name, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0) {open(name, maxDegree, minDegree);}
+  InFileTimeSplinesGravityfield() : splineDegree_(0), cacheSize(0) {}
+  InFileTimeSplinesGravityfield(const FileName &name, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, UInt nodeCountInMemory=0) {open(name, maxDegree, minDegree, nodeCountInMemory);}
  ~InFileTimeSplinesGravityfield() {close();}
 
-  void  open(const FileName &name, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0);
+  /** @brief Open file and read the header only.
+  * The nodal points are read on demand. At most @p nodeCountInMemory nodes (at least splineDegree+1)
+  * are kept in memory, the least recently used node is dropped first. */
+  void  open(const FileName &name, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, UInt nodeCountInMemory=0);
   void  close();
 
   UInt splineDegree() const {return splineDegree_;}
@@ -81,6 +89,11 @@ public:
 
   /// interpolated at @p time.
   SphericalHarmonics sphericalHarmonics(const Time &time, Double factor=1.0);
+
+  /** @brief Spline interval containing @p time.
+  * @p coeff are the basis spline weights of the nodal points idx,...,idx+splineDegree.
+  * @return idx: first nodal point of the spline support */
+  UInt interval(const Time &time, Vector &coeff) const;
 };
 
 /***** FUNCTIONS *******************************/
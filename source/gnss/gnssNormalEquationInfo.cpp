@@ -30,6 +30,7 @@ GnssNormalEquationInfo::GnssNormalEquationInfo(UInt countEpoch, UInt countReceiv
     defaultBlockCountReduction(32),
     keepEpochNormalsInMemory(TRUE),
     accumulateEpochObservations(FALSE),
+    keepObservationEquationsInMemory(FALSE),
     blockCountEpoch_(countEpoch, 0)
 {
   std::iota(idEpochs.begin(), idEpochs.end(), 0);
@@ -51,6 +51,7 @@ public:
   UInt                      defaultBlockCountReduction;
   Bool                      keepEpochNormalsInMemory;
   Bool                      accumulateEpochObservations;
+  Bool                      keepObservationEquationsInMemory;
 
   GnssNormalEquationInfo(UInt countEpoch, UInt countReceiver, UInt countTransmitter, Parallel::CommunicatorPtr comm);
 
@@ -210,8 +210,7 @@ Double GnssParametrizationTransmitterDynamicOrbits::updateParameter(const GnssNo
         para->x += dx;
         const Vector dpos = para->polynomial.interpolate(para->trans->timesPosVel, para->PosDesign * dx, 3);
         const Vector dvel = para->polynomial.interpolate(para->trans->timesPosVel, para->VelDesign * dx, 3);
-        para->trans->pos += reshape(dpos, 3, para->trans->pos.rows()).trans();
-        para->trans->vel += reshape(dvel, 3, para->trans->vel.rows()).trans();
+        para->trans->updateOrbit(reshape(dpos, 3, para->trans->pos.rows()).trans(), reshape(dvel, 3, para->trans->vel.rows()).trans());
 
         for(UInt i=0; i<para->trans->timesPosVel.size(); i++)
           if(info.update(1e3*norm(dpos.row(3*i, 3))))
@@ -271,10 +271,19 @@ void GnssProcessingStep::State::collectNormalsBlocks(UInt blockStart, UInt block
 
 /***********************************************/
 
-void GnssProcessingStep::State::buildNormals(Bool constraintsOnly, Bool solveEpochParameters)
+void GnssProcessingStep::State::buildNormals(Bool constraintsOnly, Bool solveEpochParameters, Bool keepObservationEquations)
 {
   try
   {
+    eqnsInMemory.clear();
+    if(keepObservationEquations && !constraintsOnly)
+    {
+      eqnsInMemory.resize(gnss->receivers.size());
+      for(UInt idRecv=0; idRecv<gnss->receivers.size(); idRecv++)
+        if(normalEquationInfo.estimateReceiver.at(idRecv) && gnss->receivers.at(idRecv)->isMyRank())
+          eqnsInMemory.at(idRecv).resize(gnss->times.size());
+    }
+
     normals.initEmpty(normalEquationInfo.blockIndices(), normalEquationInfo.comm,
                       std::bind(&GnssNormalEquationInfo::normalsBlockRank, &normalEquationInfo, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
     n.resize(normals.blockCount());
@@ -309,6 +318,8 @@ void GnssProcessingStep::State::buildNormals(Bool constraintsOnly, Bool solveEpo
             for(UInt idTrans=0; idTrans<gnss->receivers.at(idRecv)->idTransmitterSize(idEpoch); idTrans++)
               if(gnss->basicObservationEquations(normalEquationInfo, idRecv, idTrans, idEpoch, eqns.at(countEqn)))
               {
+                if(eqnsInMemory.size())
+                  eqnsInMemory.at(idRecv).at(idEpoch).push_back(eqns.at(countEqn)); // before elimination of group parameters
                 eqns.at(countEqn).eliminateGroupParameters();
                 if(!normalEquationInfo.accumulateEpochObservations)
                 {
@@ -396,6 +407,35 @@ void GnssProcessingStep::State::buildNormals(Bool constraintsOnly, Bool solveEpo
 
 /***********************************************/
 
+void GnssProcessingStep::State::observationEquations(UInt idRecv, UInt idEpoch, Bool release, std::vector<GnssObservationEquation> &eqns)
+{
+  try
+  {
+    if(eqnsInMemory.size()) // kept by buildNormals
+    {
+      if(release)
+        eqns = std::move(eqnsInMemory.at(idRecv).at(idEpoch));
+      else
+        eqns = eqnsInMemory.at(idRecv).at(idEpoch);
+      return;
+    }
+
+    eqns.clear();
+    for(UInt idTrans=0; idTrans<gnss->receivers.at(idRecv)->idTransmitterSize(idEpoch); idTrans++)
+    {
+      eqns.emplace_back();
+      if(!gnss->basicObservationEquations(normalEquationInfo, idRecv, idTrans, idEpoch, eqns.back()))
+        eqns.pop_back();
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Double GnssProcessingStep::State::estimateSolution(const std::function<Vector(const_MatrixSliceRef xFloat, MatrixSliceRef W, const_MatrixSliceRef d, Vector &xInt, Double &sigma)> &searchInteger,
                                                    const std::vector<Byte> &ambiguityTransmitters, const std::vector<Byte> &ambiguityReceivers,
                                                    Bool computeResiduals, Bool computeWeights, Bool adjustSigma0, Double huber, Double huberPower)
@@ -404,7 +444,7 @@ Double GnssProcessingStep::State::estimateSolution(const std::function<Vector(co
   {
     // setup normal equations
     const Bool solveEpochParameters = !normalEquationInfo.keepEpochNormalsInMemory && (normalEquationInfo.blockInterval() < normalEquationInfo.blockCount());
-    buildNormals(FALSE/*constraintsOnly*/, solveEpochParameters);
+    buildNormals(FALSE/*constraintsOnly*/, solveEpochParameters, normalEquationInfo.keepObservationEquationsInMemory && (solveEpochParameters || computeResiduals));
 
     // eliminate all other parameters from the ambiguity normals
     // ---------------------------------------------------------
@@ -496,18 +536,20 @@ Double GnssProcessingStep::State::estimateSolution(const std::function<Vector(co
         timer.loopStep(idLoop++);
 
         // loop over all receivers
-        GnssObservationEquation eqn;
+        std::vector<GnssObservationEquation> eqns;
         for(UInt idRecv=0; idRecv<gnss->receivers.size(); idRecv++)
           if(normalEquationInfo.estimateReceiver.at(idRecv) && gnss->receivers.at(idRecv)->isMyRank())
-            for(UInt idTrans=0; idTrans<gnss->receivers.at(idRecv)->idTransmitterSize(idEpoch); idTrans++)
-              if(gnss->basicObservationEquations(normalEquationInfo, idRecv, idTrans, idEpoch, eqn))
-              {
-                eqn.eliminateGroupParameters();
-                A.init(eqn.l);
-                gnss->designMatrix(normalEquationInfo, eqn, A);
-                A.transMult(eqn.l-A.mult(n, blockStart, normalEquationInfo.blockCount()-blockStart), n, 0, blockStart);
-                A.transMult(-A.mult(monteCarlo, blockStart, blockCount), monteCarlo, 0, blockStart);
-              }
+          {
+            observationEquations(idRecv, idEpoch, !computeResiduals/*release*/, eqns);
+            for(GnssObservationEquation &eqn : eqns)
+            {
+              eqn.eliminateGroupParameters();
+              A.init(eqn.l);
+              gnss->designMatrix(normalEquationInfo, eqn, A);
+              A.transMult(eqn.l-A.mult(n, blockStart, normalEquationInfo.blockCount()-blockStart), n, 0, blockStart);
+              A.transMult(-A.mult(monteCarlo, blockStart, blockCount), monteCarlo, 0, blockStart);
+            }
+          }
       } // for(idEpoch)
       Parallel::barrier(normalEquationInfo.comm);
       timer.loopEnd();
@@ -572,6 +614,7 @@ Double GnssProcessingStep::State::estimateSolution(const std::function<Vector(co
     Parallel::broadCast(x, 0, normalEquationInfo.comm);
     if(!computeResiduals)
     {
+      eqnsInMemory.clear();
       logInfo<<"Parameter changes"<<Log::endl;
       return gnss->updateParameter(normalEquationInfo, x, Matrix());
     }
@@ -615,72 +658,74 @@ Double GnssProcessingStep::State::estimateSolution(const std::function<Vector(co
       for(UInt idRecv=0; idRecv<gnss->receivers.size(); idRecv++)
         if(normalEquationInfo.estimateReceiver.at(idRecv) && gnss->receivers.at(idRecv)->isMyRank())
         {
-          GnssObservationEquation eqn;
-          for(UInt idTrans=0; idTrans<gnss->receivers.at(idRecv)->idTransmitterSize(idEpoch); idTrans++)
-            if(gnss->basicObservationEquations(normalEquationInfo, idRecv, idTrans, idEpoch, eqn))
+          std::vector<GnssObservationEquation> eqns;
+          observationEquations(idRecv, idEpoch, TRUE/*release*/, eqns);
+          for(GnssObservationEquation &eqn : eqns)
+          {
+            const UInt idTrans = eqn.transmitter->idTrans();
+            // setup observation equations
+            A.init(eqn.l);
+            gnss->designMatrix(normalEquationInfo, eqn, A);
+            Vector We  = eqn.l - A.mult(x); // decorrelated residuals
+            Matrix AWz = A.mult(Wz);        // redundancies
+
+            // estimate & reduce B parameters (ionosphere)
+            // -------------------------------------------
+            if(eqn.B.size())
             {
-              // setup observation equations
-              A.init(eqn.l);
-              gnss->designMatrix(normalEquationInfo, eqn, A);
-              Vector We  = eqn.l - A.mult(x); // decorrelated residuals
-              Matrix AWz = A.mult(Wz);        // redundancies
-
-              // estimate & reduce B parameters (ionosphere)
-              // -------------------------------------------
-              if(eqn.B.size())
-              {
-                // estimate and eliminate STEC parameter
-                Matrix B = eqn.B;
-                Vector tau = QR_decomposition(B);
-                QTransMult(B, tau, We);
-                triangularSolve(1., B.row(0, B.columns()), We.row(0, B.columns()));
-                eqn.receiver->observation(eqn.transmitter->idTrans(), eqn.idEpoch)->updateParameter(We.row(0,B.columns())); // ionosphere parameter
-
-                if((norm(eqn.sigma-eqn.sigma0) < 1e-8) && infoTec.update(We(0)))
-                  infoTec.info = "STEC ("+eqn.receiver->name()+", "+eqn.transmitter->name()+", "+eqn.timeRecv.dateTimeStr()+")";
-
-                // STEC statistics
-                const Double STEC = gnss->receivers.at(idRecv)->observation(idTrans, idEpoch)->dSTEC;
-                minSTEC   = std::min(STEC, minSTEC);
-                maxSTEC   = std::max(STEC, maxSTEC);
-                meanSTEC += STEC;
-                stdSTEC  += STEC*STEC;
-                countSTEC++;
-
-                // remove STEC from residuals
-                We.row(0, B.columns()).setNull();
-                QMult(B, tau, We);
-
-                // influence of B parameters = B(B'B)^(-1)B'
-                QTransMult(B, tau, AWz);
-                AWz.row(0, B.columns()).setNull();
-                for(UInt i=0; i<B.columns(); i++)
-                  AWz(i,i) = 1.0;
-                QMult(B, tau, AWz);
-              }
+              // estimate and eliminate STEC parameter
+              Matrix B = eqn.B;
+              Vector tau = QR_decomposition(B);
+              QTransMult(B, tau, We);
+              triangularSolve(1., B.row(0, B.columns()), We.row(0, B.columns()));
+              eqn.receiver->observation(eqn.transmitter->idTrans(), eqn.idEpoch)->updateParameter(We.row(0,B.columns())); // ionosphere parameter
+
+              if((norm(eqn.sigma-eqn.sigma0) < 1e-8) && infoTec.update(We(0)))
+                infoTec.info = "STEC ("+eqn.receiver->name()+", "+eqn.transmitter->name()+", "+eqn.timeRecv.dateTimeStr()+")";
+
+              // STEC statistics
+              const Double STEC = gnss->receivers.at(idRecv)->observation(idTrans, idEpoch)->dSTEC;
+              minSTEC   = std::min(STEC, minSTEC);
+              maxSTEC   = std::max(STEC, maxSTEC);
+              meanSTEC += STEC;
+              stdSTEC  += STEC*STEC;
+              countSTEC++;
+
+              // remove STEC from residuals
+              We.row(0, B.columns()).setNull();
+              QMult(B, tau, We);
+
+              // influence of B parameters = B(B'B)^(-1)B'
+              QTransMult(B, tau, AWz);
+              AWz.row(0, B.columns()).setNull();
+              for(UInt i=0; i<B.columns(); i++)
+                AWz(i,i) = 1.0;
+              QMult(B, tau, AWz);
+            }
 
-              // redundancies
-              // ------------
-              Vector r(We.rows());
-              for(UInt i=0; i<We.rows(); i++)
-                r(i) = 1. - quadsum(AWz.row(i));
+            // redundancies
+            // ------------
+            Vector r(We.rows());
+            for(UInt i=0; i<We.rows(); i++)
+              r(i) = 1. - quadsum(AWz.row(i));
 
-              // find max. residual (for statistics)
-              // -----------------------------------
-              if(norm(eqn.sigma-eqn.sigma0) < 1e-8) // without outlier
-                for(UInt k=0; k<eqn.types.size(); k++)
-                {
-                  const UInt idType = GnssType::index(typesResiduals, eqn.types.at(k));
-                  if(infosResiduals.at(idType).update(1e3*(We(k)*eqn.sigma(k) - gnss->receivers.at(idRecv)->observation(idTrans, idEpoch)->at(eqn.types.at(k)).residuals)))
-                    infosResiduals.at(idType).info = (typesResiduals.at(idType)+eqn.transmitter->PRN()).str()+", ("+ eqn.receiver->name()+", "+gnss->times.at(idEpoch).dateTimeStr()+")";
-                } // for(k)
+            // find max. residual (for statistics)
+            // -----------------------------------
+            if(norm(eqn.sigma-eqn.sigma0) < 1e-8) // without outlier
+              for(UInt k=0; k<eqn.types.size(); k++)
+              {
+                const UInt idType = GnssType::index(typesResiduals, eqn.types.at(k));
+                if(infosResiduals.at(idType).update(1e3*(We(k)*eqn.sigma(k) - gnss->receivers.at(idRecv)->observation(idTrans, idEpoch)->at(eqn.types.at(k)).residuals)))
+                  infosResiduals.at(idType).info = (typesResiduals.at(idType)+eqn.transmitter->PRN()).str()+", ("+ eqn.receiver->name()+", "+gnss->times.at(idEpoch).dateTimeStr()+")";
+              } // for(k)
 
-              gnss->receivers.at(idRecv)->observation(idTrans, idEpoch)->setDecorrelatedResiduals(eqn.types, We, r);
-            } // for(idTrans)
+            gnss->receivers.at(idRecv)->observation(idTrans, idEpoch)->setDecorrelatedResiduals(eqn.types, We, r);
+          } // for(eqn)
         } // for(idRecv)
     } // for(idEpoch)
     Parallel::barrier(normalEquationInfo.comm);
     timer.loopEnd();
+    eqnsInMemory.clear();
 
     // new weights
     // -----------
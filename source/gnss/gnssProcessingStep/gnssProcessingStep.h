@@ -77,13 +77,15 @@ public:
     UInt                               obsCount; // at master (after solve)
     std::vector<std::vector<GnssType>> sigmaType;
     std::vector<std::vector<Double>>   sigmaFactor; // for each receiver and type
+    std::vector<std::vector<std::vector<GnssObservationEquation>>> eqnsInMemory; // for each receiver and epoch (see keepObservationEquationsInMemory)
 
     /** @brief Constructor. */
     State(GnssPtr gnss, Parallel::CommunicatorPtr comm);
 
     void regularizeNotUsedParameters(UInt blockStart, UInt blockCount, const std::vector<ParameterName> &parameterNames);
     void collectNormalsBlocks       (UInt blockStart, UInt blockCount);
-    void buildNormals               (Bool constraintsOnly, Bool solveEpochParameters);
+    void buildNormals               (Bool constraintsOnly, Bool solveEpochParameters, Bool keepObservationEquations=FALSE);
+    void observationEquations       (UInt idRecv, UInt idEpoch, Bool release, std::vector<GnssObservationEquation> &eqns);
     Double estimateSolution         (const std::function<Vector(const_MatrixSliceRef xFloat, MatrixSliceRef W, const_MatrixSliceRef d, Vector &xInt, Double &sigma)> &searchInteger,
                                      const std::vector<Byte> &ambiguityTransmitters, const std::vector<Byte> &ambiguityReceivers,
                                      Bool computeResiduals,  Bool computeWeights, Bool adjustSigma0, Double huber, Double huberPower);
@@ -35,6 +35,10 @@ If \config{keepEpochNormalsInMemory}=\verb|no| epoch blocks are eliminated after
 of parameters in the normal equation system. \config{defaultBlockCountReduction} controls after how many epoch blocks
 an elimination step is performed. For larger processing setups or high sampling rates epoch block elimination is recommended
 as the large number of clock parameters require a lot of memory.
+
+If \config{keepObservationEquationsInMemory}=\verb|yes| the observation equations computed while accumulating the normals
+are kept in memory and reused for the reconstruction of the eliminated epoch parameters and the computation of the residuals
+instead of evaluating the observation models (geometry, antenna corrections, troposphere, ...) again within each iteration.
 )";
 #endif
 
@@ -55,6 +59,7 @@ class GnssProcessingStepSelectNormalsBlockStructure : public GnssProcessingStepB
   UInt defaultBlockCountReduction;
   Bool keepEpochNormalsInMemory;
   Bool accumulateEpochObservations;
+  Bool keepObservationEquationsInMemory;
 
 public:
   GnssProcessingStepSelectNormalsBlockStructure(Config &config);
@@ -75,6 +80,7 @@ inline GnssProcessingStepSelectNormalsBlockStructure::GnssProcessingStepSelectNo
     readConfig(config, "defaultBlockCountReduction",  defaultBlockCountReduction,  Config::DEFAULT,  "32", "minimum number of blocks for epoch reduction");
     readConfig(config, "keepEpochNormalsInMemory",    keepEpochNormalsInMemory,    Config::DEFAULT,  "1",  "speeds up processing but uses much more memory");
     readConfig(config, "accumulateEpochObservations", accumulateEpochObservations, Config::DEFAULT,  "0",  "set up all observations per epoch and receiver at once");
+    readConfig(config, "keepObservationEquationsInMemory", keepObservationEquationsInMemory, Config::DEFAULT, "0", "evaluate observation equations once per iteration, uses much more memory");
   }
   catch(std::exception &e)
   {
@@ -96,6 +102,7 @@ inline void GnssProcessingStepSelectNormalsBlockStructure::process(GnssProcessin
     state.normalEquationInfo.defaultBlockCountReduction  = defaultBlockCountReduction;
     state.normalEquationInfo.keepEpochNormalsInMemory    = keepEpochNormalsInMemory;
     state.normalEquationInfo.accumulateEpochObservations = accumulateEpochObservations;
+    state.normalEquationInfo.keepObservationEquationsInMemory = keepObservationEquationsInMemory;
     logInfo<<"  blockSizeEpoch              = "<<state.normalEquationInfo.defaultBlockSizeEpoch    <<Log::endl;
     logInfo<<"  blockSizeInterval           = "<<state.normalEquationInfo.defaultBlockSizeInterval <<Log::endl;
     logInfo<<"  blockSizeAmbiguity          = "<<state.normalEquationInfo.defaultBlockSizeAmbiguity <<Log::endl;
@@ -103,6 +110,7 @@ inline void GnssProcessingStepSelectNormalsBlockStructure::process(GnssProcessin
     logInfo<<"  blockCountReduction         = "<<state.normalEquationInfo.defaultBlockCountReduction<<Log::endl;
     logInfo<<"  keepEpochNormalsInMemory    = "<<(state.normalEquationInfo.keepEpochNormalsInMemory ? "yes" : "no")<<Log::endl;
     logInfo<<"  accumulateEpochObservations = "<<(state.normalEquationInfo.accumulateEpochObservations ? "yes" : "no")<<Log::endl;
+    logInfo<<"  keepObservationEquationsInMemory = "<<(state.normalEquationInfo.keepObservationEquationsInMemory ? "yes" : "no")<<Log::endl;
     state.changedNormalEquationInfo = TRUE;
   }
   catch(std::exception &e)
@@ -19,6 +19,8 @@
 #include "files/fileMatrix.h"
 #include "files/fileInstrument.h"
 #include "inputOutput/logging.h"
+#include "inputOutput/system.h"
+#include "inputOutput/fileArchive.h"
 #include "misc/varianceComponentEstimation.h"
 #include "gnss/gnssLambda.h"
 #include "gnss/gnssObservation.h"
@@ -98,6 +100,10 @@ void GnssReceiver::disable(const std::string &reason)
     observations_.clear();
     observations_.shrink_to_fit();
     tracks.clear();
+    obsMemCache.clear();
+    observationsCache.clear();
+    tracksCache.clear();
+    cachedEpochs.clear();
   }
   catch(std::exception &e)
   {
@@ -123,7 +129,8 @@ void GnssReceiver::deleteObservation(UInt idTrans, UInt idEpoch)
     if(!observation(idTrans, idEpoch))
       return;
     observations_[idEpoch][idTrans] = nullptr;
-    if(std::all_of(observations_[idEpoch].begin(), observations_[idEpoch].end(), [](auto obs) {return obs == nullptr;}))
+    auto isEmpty = [](const std::vector<GnssObservation*> &obsEpoch) {return std::all_of(obsEpoch.begin(), obsEpoch.end(), [](auto obs) {return obs == nullptr;});};
+    if(isEmpty(observations_[idEpoch]) && ((idEpoch >= observationsCache.size()) || isEmpty(observationsCache[idEpoch])))
       disable(idEpoch, "no valid epochs left");
   }
   catch(std::exception &e)
@@ -447,6 +454,300 @@ void GnssReceiver::readObservations(const FileName &fileName, const std::vector<
 
 /***********************************************/
 
+static const char *const FILE_GNSSPREPROCESSINGCACHE_TYPE    = "gnssPreprocessingCache";
+constexpr UInt           FILE_GNSSPREPROCESSINGCACHE_VERSION = std::max(UInt(20261018), FILE_BASE_VERSION);
+
+/***********************************************/
+
+void GnssReceiver::writePreprocessingCache(const FileName &fileName, const std::string &key, const std::vector<Time> &segmentTimes, const std::vector<std::string> &segmentKeys) const
+{
+  try
+  {
+    if(!useable())
+      throw(Exception(name()+": disabled receiver cannot be cached"));
+
+    OutFileArchive file(fileName, FILE_GNSSPREPROCESSINGCACHE_TYPE, FILE_GNSSPREPROCESSINGCACHE_VERSION);
+    file<<nameValue("key",          key);
+    file<<nameValue("segmentTimes", segmentTimes);
+    file<<nameValue("segmentKeys",  segmentKeys);
+
+    Vector useableEpochs(times.size());
+    for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+      useableEpochs(idEpoch) = useable(idEpoch);
+    file<<nameValue("times",         times);
+    file<<nameValue("clock",         clk);
+    file<<nameValue("useableEpochs", useableEpochs);
+
+    std::map<const GnssTrack*, UInt> idTrack;
+    file<<nameValue("trackCount", tracks.size());
+    for(UInt i=0; i<tracks.size(); i++)
+    {
+      idTrack[tracks.at(i).get()] = i;
+      file<<nameValue("idTrans",      tracks.at(i)->transmitter->idTrans());
+      file<<nameValue("idEpochStart", tracks.at(i)->idEpochStart);
+      file<<nameValue("idEpochEnd",   tracks.at(i)->idEpochEnd);
+      file<<nameValue("types",        tracks.at(i)->types);
+    }
+
+    UInt count = 0;
+    for(UInt idEpoch=0; idEpoch<idEpochSize(); idEpoch++)
+      for(UInt idTrans=0; idTrans<idTransmitterSize(idEpoch); idTrans++)
+        if(observation(idTrans, idEpoch))
+          count++;
+    file<<nameValue("observationCount", count);
+    for(UInt idEpoch=0; idEpoch<idEpochSize(); idEpoch++)
+      for(UInt idTrans=0; idTrans<idTransmitterSize(idEpoch); idTrans++)
+      {
+        const GnssObservation *obs = observation(idTrans, idEpoch);
+        if(!obs)
+          continue;
+        file<<nameValue("idEpoch",   idEpoch);
+        file<<nameValue("idTrans",   idTrans);
+        file<<nameValue("idTrack",   (obs->track ? idTrack.at(obs->track) : NULLINDEX));
+        file<<nameValue("STEC",      obs->STEC);
+        file<<nameValue("dSTEC",     obs->dSTEC);
+        file<<nameValue("sigmaSTEC", obs->sigmaSTEC);
+        file<<nameValue("typeCount", obs->size());
+        for(UInt idType=0; idType<obs->size(); idType++)
+        {
+          file<<nameValue("type",        obs->at(idType).type);
+          file<<nameValue("observation", obs->at(idType).observation);
+          file<<nameValue("residuals",   obs->at(idType).residuals);
+          file<<nameValue("redundancy",  obs->at(idType).redundancy);
+          file<<nameValue("sigma0",      obs->at(idType).sigma0);
+          file<<nameValue("sigma",       obs->at(idType).sigma);
+        }
+      }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool GnssReceiver::readPreprocessingCache(const FileName &fileName, const std::string &key, const std::vector<Time> &segmentTimes, const std::vector<std::string> &segmentKeys,
+                                          const std::vector<GnssTransmitterPtr> &transmitters)
+{
+  try
+  {
+    if(fileName.empty() || !System::exists(fileName))
+      return FALSE;
+
+    InFileArchive file(fileName, FILE_GNSSPREPROCESSINGCACHE_TYPE, FILE_GNSSPREPROCESSINGCACHE_VERSION);
+    std::string keyFile;
+    file>>nameValue("key", keyFile);
+    if(keyFile != key)
+      return FALSE;
+
+    // read everything before changing the receiver
+    std::vector<Time>        segmentTimesFile, timesFile;
+    std::vector<std::string> segmentKeysFile;
+    std::vector<Double>      clkFile;
+    Vector                   useableEpochs;
+    file>>nameValue("segmentTimes",  segmentTimesFile);
+    file>>nameValue("segmentKeys",   segmentKeysFile);
+    file>>nameValue("times",         timesFile);
+    file>>nameValue("clock",         clkFile);
+    file>>nameValue("useableEpochs", useableEpochs);
+    if((segmentKeysFile.size() != segmentTimesFile.size()) || (clkFile.size() != timesFile.size()) || (useableEpochs.size() != timesFile.size()))
+      throw(Exception("number of epochs does not match"));
+
+    UInt trackCount;
+    file>>nameValue("trackCount", trackCount);
+    std::vector<UInt> trackTrans(trackCount), trackStart(trackCount), trackEnd(trackCount);
+    std::vector<std::vector<GnssType>> trackTypes(trackCount);
+    for(UInt i=0; i<trackCount; i++)
+    {
+      file>>nameValue("idTrans",      trackTrans.at(i));
+      file>>nameValue("idEpochStart", trackStart.at(i));
+      file>>nameValue("idEpochEnd",   trackEnd.at(i));
+      file>>nameValue("types",        trackTypes.at(i));
+      if((trackTrans.at(i) >= transmitters.size()) || (trackStart.at(i) > trackEnd.at(i)) || (trackEnd.at(i) >= timesFile.size()))
+        throw(Exception("track index out of range"));
+    }
+
+    UInt count;
+    file>>nameValue("observationCount", count);
+    std::vector<GnssObservation> obsFile(count);
+    std::vector<UInt> obsEpoch(count), obsTrans(count), obsTrack(count);
+    std::vector<std::vector<UInt>> indexObs(timesFile.size()); // for each epoch and transmitter
+    for(UInt i=0; i<count; i++)
+    {
+      UInt typeCount;
+      GnssObservation &obs = obsFile.at(i);
+      file>>nameValue("idEpoch",   obsEpoch.at(i));
+      file>>nameValue("idTrans",   obsTrans.at(i));
+      file>>nameValue("idTrack",   obsTrack.at(i));
+      file>>nameValue("STEC",      obs.STEC);
+      file>>nameValue("dSTEC",     obs.dSTEC);
+      file>>nameValue("sigmaSTEC", obs.sigmaSTEC);
+      file>>nameValue("typeCount", typeCount);
+      for(UInt idType=0; idType<typeCount; idType++)
+      {
+        GnssSingleObservation single;
+        file>>nameValue("type",        single.type);
+        file>>nameValue("observation", single.observation);
+        file>>nameValue("residuals",   single.residuals);
+        file>>nameValue("redundancy",  single.redundancy);
+        file>>nameValue("sigma0",      single.sigma0);
+        file>>nameValue("sigma",       single.sigma);
+        obs.push_back(single);
+      }
+      obs.shrink_to_fit();
+      if((obsTrans.at(i) >= transmitters.size()) || (obsEpoch.at(i) >= timesFile.size()) || ((obsTrack.at(i) != NULLINDEX) && (obsTrack.at(i) >= trackCount)))
+        throw(Exception("observation index out of range"));
+      if(indexObs.at(obsEpoch.at(i)).size() <= obsTrans.at(i))
+        indexObs.at(obsEpoch.at(i)).resize(obsTrans.at(i)+1, NULLINDEX);
+      indexObs.at(obsEpoch.at(i)).at(obsTrans.at(i)) = i;
+    }
+
+    // unchanged epochs: in cache and same key of the time segment
+    // -----------------------------------------------------------
+    std::vector<UInt> idEpochFile(times.size(), NULLINDEX);    // for each epoch
+    std::vector<UInt> idEpochNew(timesFile.size(), NULLINDEX); // for each epoch in cache
+    for(UInt idEpoch=0, k=0; idEpoch<times.size(); idEpoch++)
+    {
+      while((k < timesFile.size()) && (timesFile.at(k) < times.at(idEpoch)))
+        k++;
+      if((k >= timesFile.size()) || (timesFile.at(k) != times.at(idEpoch)))
+        continue;
+      const UInt idSegment = std::distance(segmentTimes.begin(), std::upper_bound(segmentTimes.begin(), segmentTimes.end(), times.at(idEpoch)));
+      if(!idSegment)
+        continue;
+      const UInt idSegmentFile = std::distance(segmentTimesFile.begin(), std::find(segmentTimesFile.begin(), segmentTimesFile.end(), segmentTimes.at(idSegment-1)));
+      if((idSegmentFile < segmentKeysFile.size()) && (segmentKeysFile.at(idSegmentFile) == segmentKeys.at(idSegment-1)))
+      {
+        idEpochFile.at(idEpoch) = k;
+        idEpochNew.at(k) = idEpoch;
+      }
+    }
+    if(std::all_of(idEpochFile.begin(), idEpochFile.end(), [](UInt k) {return k == NULLINDEX;}))
+      return FALSE;
+
+    // tracks with unchanged epochs only
+    // ---------------------------------
+    std::vector<Bool> restore(trackCount, FALSE);
+    for(UInt i=0; i<trackCount; i++)
+    {
+      const UInt idEpochStart = idEpochNew.at(trackStart.at(i));
+      const UInt idEpochEnd   = idEpochNew.at(trackEnd.at(i));
+      restore.at(i) = (idEpochStart != NULLINDEX) && (idEpochEnd != NULLINDEX) && (idEpochEnd-idEpochStart == trackEnd.at(i)-trackStart.at(i)) &&
+                      std::all_of(idEpochFile.begin()+idEpochStart, idEpochFile.begin()+idEpochEnd+1, [](UInt k) {return k != NULLINDEX;});
+    }
+
+    // observations to be preprocessed again: in changed epochs or in tracks not restored
+    // (observations of unchanged epochs not in cache have been removed in the preprocessing)
+    auto isPreprocessed = [&](UInt idTrans, UInt idEpoch)
+    {
+      if(!observation(idTrans, idEpoch))
+        return FALSE;
+      const UInt k = idEpochFile.at(idEpoch);
+      if(k == NULLINDEX)
+        return TRUE;
+      const UInt i = (idTrans < indexObs.at(k).size()) ? indexObs.at(k).at(idTrans) : NULLINDEX;
+      return (i != NULLINDEX) && ((obsTrack.at(i) == NULLINDEX) || !restore.at(obsTrack.at(i)));
+    };
+
+    // restored tracks must not be continued by observations preprocessed again (see createTracks)
+    for(Bool changed=TRUE; changed;)
+    {
+      changed = FALSE;
+      for(UInt i=0; i<trackCount; i++)
+        if(restore.at(i))
+        {
+          const UInt idTrans      = trackTrans.at(i);
+          const UInt idEpochStart = idEpochNew.at(trackStart.at(i));
+          const UInt idEpochEnd   = idEpochNew.at(trackEnd.at(i));
+          for(UInt idEpoch=idEpochStart; restore.at(i) && (idEpoch-- > 0) && ((times.at(idEpochStart)-times.at(idEpoch)).seconds() <= 1.5*observationSampling);)
+            restore.at(i) = !isPreprocessed(idTrans, idEpoch);
+          for(UInt idEpoch=idEpochEnd+1; restore.at(i) && (idEpoch < times.size()) && ((times.at(idEpoch)-times.at(idEpochEnd)).seconds() <= 1.5*observationSampling); idEpoch++)
+            restore.at(i) = !isPreprocessed(idTrans, idEpoch);
+          changed = changed || !restore.at(i);
+        }
+    }
+
+    // restore state
+    // -------------
+    std::vector<GnssTrackPtr> tracksFile(trackCount);
+    for(UInt i=0; i<trackCount; i++)
+      if(restore.at(i))
+      {
+        tracksFile.at(i) = std::make_shared<GnssTrack>(this, transmitters.at(trackTrans.at(i)).get(), idEpochNew.at(trackStart.at(i)), idEpochNew.at(trackEnd.at(i)), trackTypes.at(i));
+        tracksCache.push_back(tracksFile.at(i));
+      }
+
+    UInt countRestored = 0;
+    observationsCache.resize(times.size());
+    for(UInt i=0; i<count; i++)
+      if((obsTrack.at(i) != NULLINDEX) && restore.at(obsTrack.at(i)))
+      {
+        const UInt idEpoch = idEpochNew.at(obsEpoch.at(i));
+        obsFile.at(i).track = tracksFile.at(obsTrack.at(i)).get();
+        if(observationsCache.at(idEpoch).size() <= obsTrans.at(i))
+          observationsCache.at(idEpoch).resize(obsTrans.at(i)+1, nullptr);
+        observationsCache.at(idEpoch).at(obsTrans.at(i)) = &obsFile.at(i);
+        countRestored++;
+      }
+    obsMemCache = std::move(obsFile); // pointers in observationsCache remain valid
+
+    cachedEpochs.resize(times.size(), FALSE);
+    for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+      if(idEpochFile.at(idEpoch) != NULLINDEX)
+      {
+        cachedEpochs.at(idEpoch) = TRUE;
+        clk.at(idEpoch) = clkFile.at(idEpochFile.at(idEpoch));
+        for(UInt idTrans=0; idTrans<idTransmitterSize(idEpoch); idTrans++)
+          if(observation(idTrans, idEpoch) && !isPreprocessed(idTrans, idEpoch))
+            observations_[idEpoch][idTrans] = nullptr; // restored or removed in preprocessing
+      }
+    for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+      if((idEpochFile.at(idEpoch) != NULLINDEX) && !useableEpochs(idEpochFile.at(idEpoch)))
+        disable(idEpoch, "disabled in preprocessing cache");
+
+    preprocessingInfo("readPreprocessingCache()", NULLINDEX, countRestored, tracksCache.size());
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GnssReceiver::mergePreprocessingCache()
+{
+  try
+  {
+    if(useable())
+    {
+      for(UInt idEpoch=0; idEpoch<std::min(observationsCache.size(), observations_.size()); idEpoch++)
+        for(UInt idTrans=0; idTrans<observationsCache.at(idEpoch).size(); idTrans++)
+          if(observationsCache.at(idEpoch).at(idTrans) && useable(idEpoch))
+          {
+            if(observations_.at(idEpoch).size() <= idTrans)
+              observations_.at(idEpoch).resize(idTrans+1, nullptr);
+            observations_.at(idEpoch).at(idTrans) = observationsCache.at(idEpoch).at(idTrans);
+          }
+      tracks.insert(tracks.end(), tracksCache.begin(), tracksCache.end());
+      std::stable_sort(tracks.begin(), tracks.end(), [](const GnssTrackPtr &t1, const GnssTrackPtr &t2)
+                       {return std::make_pair(t1->transmitter->idTrans(), t1->idEpochStart) < std::make_pair(t2->transmitter->idTrans(), t2->idEpochStart);});
+    }
+    observationsCache.clear();
+    tracksCache.clear();
+    cachedEpochs.clear();
+    preprocessingInfo("mergePreprocessingCache()");
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void GnssReceiver::simulateZeroObservations(const std::vector<GnssType> &types,
                                             const std::vector<GnssTransmitterPtr> &transmitters,
                                             const std::function<Rotary3d(const Time &time)> &rotationCrf2Trf, Angle elevationCutOff,
@@ -682,7 +983,7 @@ std::vector<Vector3d> GnssReceiver::estimateInitialClockErrorFromCodeObservation
       std::vector<std::vector<UInt>> listIndexFull;
       UInt maxSat = 0;
       for(UInt idEpoch=0; idEpoch<idEpochSize(); idEpoch++)
-        if(useable(idEpoch))
+        if(useable(idEpoch) && !isCachedEpoch(idEpoch))
         {
           // count observations and setup observation equations for each transmitter
           UInt                                 obsCount = 0;
@@ -744,6 +1045,9 @@ std::vector<Vector3d> GnssReceiver::estimateInitialClockErrorFromCodeObservation
           }
         } // for(idEpoch)
 
+      if(!listEpoch.size() && std::any_of(cachedEpochs.begin(), cachedEpochs.end(), [](Bool x) {return x;}))
+        break; // all clock errors restored from preprocessing cache
+
       if(!listEpoch.size() || (maxSat < countStaticParameters+countEpochParameters))
       {
        disable("only "+maxSat%"%i satellites tracked"s);
@@ -775,8 +1079,8 @@ std::vector<Vector3d> GnssReceiver::estimateInitialClockErrorFromCodeObservation
         {
           const Vector3d dpos(dx.row(0, 3));
           maxPosDiff = dpos.r();
-          for(UInt i=0; i<listEpoch.size(); i++)
-            pos.at(listEpoch.at(i)) += dpos;
+          for(auto &p : pos) // also epochs restored from preprocessing cache
+            p += dpos;
         }
       }
 
@@ -820,7 +1124,7 @@ void GnssReceiver::disableEpochsWithGrossCodeObservationOutliers(ObservationEqua
   try
   {
     for(UInt idEpoch=0; idEpoch<idEpochSize(); idEpoch++)
-      if(useable(idEpoch))
+      if(useable(idEpoch) && !isCachedEpoch(idEpoch))
       {
         // delete all observations to a satellite at epoch if they contain a gross code outlier
         UInt outlierCount = 0;
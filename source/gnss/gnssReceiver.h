@@ -40,7 +40,14 @@ class GnssReceiver : public GnssTransceiver
   std::vector<GnssObservation> obsMem;
   std::vector<std::vector<GnssObservation*>> observations_; // observations at receiver (for each epoch, for each transmitter)
 
+  // restored from preprocessing cache, hidden from the preprocessing until mergePreprocessingCache()
+  std::vector<GnssObservation> obsMemCache;
+  std::vector<std::vector<GnssObservation*>> observationsCache;
+  std::vector<GnssTrackPtr>    tracksCache;
+  std::vector<Bool>            cachedEpochs; // clock errors and gross code outliers are not estimated again
+
   void copyObservations2ContinuousMemoryBlock();
+  Bool isCachedEpoch(UInt idEpoch) const {return (idEpoch < cachedEpochs.size()) && cachedEpochs[idEpoch];}
 
 public:
   // public variables
@@ -147,6 +154,25 @@ public:
   void readObservations(const FileName &fileName, const std::vector<GnssTransmitterPtr> &transmitters, const std::function<Rotary3d(const Time &time)> &rotationCrf2Trf,
                         const Time &timeMargin, Angle elevationCutOff, const std::vector<GnssType> &useType, const std::vector<GnssType> &ignoreType, GnssObservation::Group group);
 
+  /** @brief Writes the preprocessed observations, tracks, clock errors, and useable epochs of a useable receiver to a cache file.
+  * The content is identified by @p key (e.g. a hash of settings) and by one key for each time segment
+  * starting at @p segmentTimes (e.g. a hash of the observations and models in the segment). */
+  void writePreprocessingCache(const FileName &fileName, const std::string &key, const std::vector<Time> &segmentTimes, const std::vector<std::string> &segmentKeys) const;
+
+  /** @brief Restores the tracks of unchanged time segments written by @a writePreprocessingCache.
+  * An epoch is unchanged if it is in the cache and the key of its segment is equal.
+  * Tracks are restored if all epochs of the track are unchanged and no observation of the same transmitter
+  * to be preprocessed again is adjacent. The clock errors and disabled epochs of unchanged epochs are restored,
+  * the observations of unchanged epochs not in the cache are removed.
+  * The restored observations are hidden from the following preprocessing steps until @a mergePreprocessingCache is called.
+  * Must be called after @a readObservations.
+  * @return FALSE if the file does not exist, was written with a different @p key, or nothing is unchanged. */
+  Bool readPreprocessingCache(const FileName &fileName, const std::string &key, const std::vector<Time> &segmentTimes, const std::vector<std::string> &segmentKeys,
+                              const std::vector<GnssTransmitterPtr> &transmitters);
+
+  /** @brief Adds the observations and tracks restored by @a readPreprocessingCache to the preprocessed ones. */
+  void mergePreprocessingCache();
+
   /** @brief Simulate observations. Member variable @a times must be set.
   * Receiver and Transmitter positions, orientations, ... must be initialized beforehand.
   * Delete observations that don't match the types from receiver and transmitter definition. */
@@ -11,6 +11,8 @@
 */
 /***********************************************/
 
+#include <thread>
+#include <atomic>
 #include "base/import.h"
 #include "base/string.h"
 #include "base/planets.h"
@@ -58,6 +60,8 @@ GnssReceiverGeneratorStationNetwork::GnssReceiverGeneratorStationNetwork(Config
     readConfig(config, "inputfileStationPosition",           fileNameStationPosition, Config::OPTIONAL, "{groopsDataDir}/gnss/receiverStation/position/igs/igs20/stationPosition.{station}.dat", "variable {station} available.");
     readConfig(config, "inputfileClock",                     fileNameClock,           Config::OPTIONAL, "",     "variable {station} available");
     readConfig(config, "inputfileObservations",              fileNameObs,             Config::OPTIONAL, "gnssReceiver_{loopTime:%D}.{station}.dat", "variable {station} available");
+    readConfig(config, "preprocessingCache",                 fileNameCache,           Config::OPTIONAL, "",     "variable {station} available. preprocessed observations are stored and reused for unchanged time segments");
+    readConfig(config, "preprocessingCacheSegmentLength",    cacheSegmentLength,      Config::DEFAULT,  "1",    "[hours] time segments of the preprocessing cache (aligned to start of day)");
     readConfig(config, "loadingDisplacement",                gravityfield,            Config::DEFAULT,  "",     "loading deformation");
     readConfig(config, "tidalDisplacement",                  tides,                   Config::DEFAULT,  "",     "tidal deformation");
     readConfig(config, "ephemerides",                        ephemerides,             Config::OPTIONAL, "jpl",  "for tidal deformation");
@@ -92,6 +96,151 @@ GnssReceiverGeneratorStationNetwork::GnssReceiverGeneratorStationNetwork(Config
 
 /***********************************************/
 
+// FNV-1a hash
+static std::string hash(const std::string &text)
+{
+  UInt64 h = 14695981039346656037ULL;
+  for(unsigned char c : text)
+    h = (h ^ c) * 1099511628211ULL;
+  std::stringstream ss;
+  ss<<std::hex<<std::setw(16)<<std::setfill('0')<<h;
+  return ss.str();
+}
+
+/***********************************************/
+
+// hash of file content (empty if file does not exist)
+static std::string hashFile(const FileName &fileName)
+{
+  try
+  {
+    if(fileName.empty() || !System::exists(fileName))
+      return "";
+    std::ifstream file(fileName.str(), std::ios::binary);
+    std::stringstream ss;
+    ss<<file.rdbuf();
+    return hash(ss.str());
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GnssReceiverGeneratorStationNetwork::preprocessingCacheKeys(const GnssReceiver &recv, const Gnss &gnss, const std::string &definitionKey, const VariableList &fileNameVariableList,
+                                                                 std::string &key, std::vector<Time> &segmentTimes, std::vector<std::string> &segmentKeys) const
+{
+  try
+  {
+    // station, definitions, and settings
+    // ----------------------------------
+    std::stringstream ss;
+    ss.precision(15);
+    ss<<recv.name()<<"\n"<<hashFile(fileNameStationInfo(fileNameVariableList))<<" "<<definitionKey<<"\n"
+      <<recv.platform.approxPosition.x()<<" "<<recv.platform.approxPosition.y()<<" "<<recv.platform.approxPosition.z()<<"\n"
+      <<static_cast<Int>(noPatternFoundAction)<<" "<<Double(elevationCutOff)<<" "<<Double(elevationTrackMinimum)<<" "<<minObsCountPerTrack<<" "<<minEstimableEpochsRatio<<" "
+      <<huber<<" "<<huberPower<<" "<<codeMaxPosDiff<<" "<<denoisingLambda<<" "<<tecWindowSize<<" "<<tecSigmaFactor<<" "<<cacheSegmentLength<<"\n";
+    for(GnssType type : useType)
+      ss<<"+"<<type.str();
+    for(GnssType type : ignoreType)
+      ss<<"-"<<type.str();
+    ss<<"\n";
+    for(const auto &trans : gnss.transmitters)
+      ss<<trans->name()<<" ";
+    key = hash(ss.str());
+
+    // time segments: observations, a priori receiver clock and position (incl. tides and loading),
+    // transmitter orbits and clocks, earth rotation, and the reduced models at the first and last epoch
+    // -------------------------------------------------------------------------------------------------
+    std::string text;
+    auto append = [&](Double x) {text.append(reinterpret_cast<const char*>(&x), sizeof(x));};
+    auto reducedObservations = [&](UInt idEpoch)
+    {
+      for(UInt idTrans=0; idTrans<recv.idTransmitterSize(idEpoch); idTrans++)
+      {
+        const GnssObservation *obs = recv.observation(idTrans, idEpoch);
+        std::vector<GnssType> types;
+        if(obs && obs->observationList(GnssObservation::RANGE | GnssObservation::PHASE, types))
+        {
+          GnssObservationEquation eqn(*obs, recv, *gnss.transmitters.at(idTrans), gnss.funcRotationCrf2Trf, gnss.funcReduceModels, idEpoch, FALSE, types);
+          for(UInt i=0; i<eqn.l.rows(); i++)
+            append(eqn.l(i));
+        }
+      }
+    };
+
+    segmentTimes.clear();
+    segmentKeys.clear();
+    UInt idEpochFirst = NULLINDEX, idEpochLast = NULLINDEX; // with observations
+    for(UInt idEpoch=0; idEpoch<recv.times.size(); idEpoch++)
+    {
+      const Time &time = recv.times.at(idEpoch);
+      const Time timeSegment(time.mjdInt(), std::floor(time.mjdMod()*24/cacheSegmentLength+1e-9)*cacheSegmentLength/24); // aligned to start of day
+      if(!segmentTimes.size() || (segmentTimes.back() != timeSegment))
+      {
+        if(segmentTimes.size())
+        {
+          if(idEpochFirst != NULLINDEX) reducedObservations(idEpochFirst);
+          if(idEpochLast  != NULLINDEX) reducedObservations(idEpochLast);
+          segmentKeys.push_back(hash(text));
+        }
+        segmentTimes.push_back(timeSegment);
+        text.clear();
+        idEpochFirst = idEpochLast = NULLINDEX;
+      }
+
+      append(time.mjdMod());
+      append(recv.useable(idEpoch));
+      if(!recv.useable(idEpoch))
+        continue;
+      append(recv.clk.at(idEpoch));
+      for(const Vector3d &x : {recv.pos.at(idEpoch), recv.offset.at(idEpoch)})
+        for(Double value : {x.x(), x.y(), x.z()})
+          append(value);
+      const Matrix rotation = gnss.funcRotationCrf2Trf(time).matrix();
+      for(UInt i=0; i<rotation.size(); i++)
+        append(rotation.field()[i]);
+      for(UInt idTrans=0; idTrans<recv.idTransmitterSize(idEpoch); idTrans++)
+      {
+        const GnssObservation *obs = recv.observation(idTrans, idEpoch);
+        if(!obs)
+          continue;
+        if(idEpochFirst == NULLINDEX)
+          idEpochFirst = idEpoch;
+        idEpochLast = idEpoch;
+        append(idTrans);
+        for(UInt idType=0; idType<obs->size(); idType++)
+        {
+          text.append(obs->at(idType).type.str());
+          append(obs->at(idType).observation);
+        }
+        const GnssTransmitter &trans = *gnss.transmitters.at(idTrans);
+        append(trans.useable(idEpoch));
+        if(trans.useable(idEpoch))
+        {
+          const Vector3d pos = trans.position(idEpoch, time);
+          for(Double value : {pos.x(), pos.y(), pos.z(), trans.clockError(idEpoch)})
+            append(value);
+        }
+      }
+    }
+    if(segmentTimes.size())
+    {
+      if(idEpochFirst != NULLINDEX) reducedObservations(idEpochFirst);
+      if(idEpochLast  != NULLINDEX) reducedObservations(idEpochLast);
+      segmentKeys.push_back(hash(text));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void GnssReceiverGeneratorStationNetwork::init(std::vector<GnssType> simulationTypes, const std::vector<Time> &times, const Time &timeMargin,
                                                const std::vector<GnssTransmitterPtr> &transmitters, EarthRotationPtr earthRotation,
                                                Parallel::CommunicatorPtr comm, std::vector<GnssReceiverPtr> &receiversAll)
@@ -171,116 +320,181 @@ void GnssReceiverGeneratorStationNetwork::init(std::vector<GnssType> simulationT
     receiversWithAlternatives.erase(std::remove_if(receiversWithAlternatives.begin(), receiversWithAlternatives.end(),
                                                    [](auto x) {return !x.size();}), receiversWithAlternatives.end());
 
+    // distribute stations to nodes
+    // ----------------------------
+    // balanced by the size of the observation files (largest first)
+    Vector workload(receiversWithAlternatives.size(), 1.);
+    if(!isSimulation && Parallel::isMaster(comm))
+      for(UInt i=0; i<receiversWithAlternatives.size(); i++)
+      {
+        fileNameVariableList.setVariable("station", receiversWithAlternatives.at(i).front()->name());
+        UInt size;
+        Int64 lastModified;
+        if(System::fileStatus(fileNameObs(fileNameVariableList), size, lastModified))
+          workload(i) = std::max(size, UInt(1));
+      }
+    Parallel::broadCast(workload, 0, comm);
+
+    std::vector<UInt> index(receiversWithAlternatives.size());
+    std::iota(index.begin(), index.end(), 0);
+    std::stable_sort(index.begin(), index.end(), [&](UInt i, UInt k) {return workload(i) > workload(k);});
+    std::vector<Double> workloadProcess(Parallel::size(comm), 0.);
+    std::vector<UInt>   indexMyRank;
+    for(UInt i : index)
+    {
+      const UInt idProcess = std::distance(workloadProcess.begin(), std::min_element(workloadProcess.begin(), workloadProcess.end()));
+      workloadProcess.at(idProcess) += workload(i);
+      if(idProcess == Parallel::myRank(comm))
+        indexMyRank.push_back(i);
+    }
+
     // read observations at single nodes
     // ---------------------------------
     logStatus<<"read observations"<<Log::endl;
-    Vector receiverAlternative(receiversWithAlternatives.size());
-    Log::Timer timer(receiversWithAlternatives.size());
-    for(UInt i=0; i<receiversWithAlternatives.size(); i++)
-      if(i%Parallel::size(comm) == Parallel::myRank(comm)) // distribute to nodes
+    std::vector<UInt> alternative(receiversWithAlternatives.size(), 0);
+    auto readReceiver = [&](UInt i, VariableList &fileNameVariableList)
+    {
+      for(UInt k=0; k<receiversWithAlternatives.at(i).size(); k++) // test alternatives
       {
-        timer.loopStep(i);
-        for(UInt k=0; k<receiversWithAlternatives.at(i).size(); k++) // test alternatives
+        try
         {
-          try
+          fileNameVariableList.setVariable("station", receiversWithAlternatives.at(i).at(k)->name());
+          GnssReceiverPtr recv = receiversWithAlternatives.at(i).at(k);
+          recv->isMyRank_ = TRUE;
+
+          recv->times = times;
+          recv->clk.resize(times.size(), 0);
+          recv->pos.resize(times.size(), recv->platform.approxPosition);
+          recv->vel.resize(times.size());
+          recv->offset.resize(times.size());
+          recv->global2local.resize(times.size(), inverse(localNorthEastUp(recv->platform.approxPosition, Ellipsoid())));
+          recv->global2antenna.resize(times.size());
+          for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
           {
-            fileNameVariableList.setVariable("station", receiversWithAlternatives.at(i).at(k)->name());
-            GnssReceiverPtr recv = receiversWithAlternatives.at(i).at(k);
-            recv->isMyRank_ = TRUE;
-
-            recv->times = times;
-            recv->clk.resize(times.size(), 0);
-            recv->pos.resize(times.size(), recv->platform.approxPosition);
-            recv->vel.resize(times.size());
-            recv->offset.resize(times.size());
-            recv->global2local.resize(times.size(), inverse(localNorthEastUp(recv->platform.approxPosition, Ellipsoid())));
-            recv->global2antenna.resize(times.size());
-            for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+            auto antenna = recv->platform.findEquipment<PlatformGnssAntenna>(times.at(idEpoch));
+            if(antenna && antenna->antennaDef && antenna->accuracyDef)
             {
-              auto antenna = recv->platform.findEquipment<PlatformGnssAntenna>(times.at(idEpoch));
-              if(antenna && antenna->antennaDef && antenna->accuracyDef)
-              {
-                recv->offset.at(idEpoch)         = antenna->position - recv->platform.referencePoint(times.at(idEpoch));
-                recv->global2antenna.at(idEpoch) = antenna->local2antennaFrame * recv->global2local.at(idEpoch);
-              }
-              else
-                recv->disable(idEpoch, "missing antenna/accuracy patterns");
+              recv->offset.at(idEpoch)         = antenna->position - recv->platform.referencePoint(times.at(idEpoch));
+              recv->global2antenna.at(idEpoch) = antenna->local2antennaFrame * recv->global2local.at(idEpoch);
             }
+            else
+              recv->disable(idEpoch, "missing antenna/accuracy patterns");
+          }
 
-            recv->preprocessingInfo("init()");
+          recv->preprocessingInfo("init()");
 
-            auto rotationCrf2Trf = std::bind(&EarthRotation::rotaryMatrix, earthRotation, std::placeholders::_1);
-            if(isSimulation)
-            {
-              recv->simulateZeroObservations(simulationTypes, transmitters, rotationCrf2Trf, elevationCutOff,
-                                             useType, ignoreType, GnssObservation::RANGE | GnssObservation::PHASE);
-            }
-            else
-            {
-              recv->readObservations(fileNameObs(fileNameVariableList), transmitters, rotationCrf2Trf, timeMargin, elevationCutOff,
-                                     useType, ignoreType, GnssObservation::RANGE | GnssObservation::PHASE);
-            }
+          auto rotationCrf2Trf = std::bind(&EarthRotation::rotaryMatrix, earthRotation, std::placeholders::_1);
+          if(isSimulation)
+          {
+            recv->simulateZeroObservations(simulationTypes, transmitters, rotationCrf2Trf, elevationCutOff,
+                                           useType, ignoreType, GnssObservation::RANGE | GnssObservation::PHASE);
+          }
+          else
+          {
+            recv->readObservations(fileNameObs(fileNameVariableList), transmitters, rotationCrf2Trf, timeMargin, elevationCutOff,
+                                   useType, ignoreType, GnssObservation::RANGE | GnssObservation::PHASE);
+          }
 
-            auto enoughEpochs = [&]()
-            {
-              // count epochs with observations
-              UInt countEpochs = 0;
-              for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
-                if(recv->useable(idEpoch))
-                  countEpochs++;
-              return (countEpochs*recv->observationSampling >= minEstimableEpochsRatio*times.size()*medianSampling(times).seconds());
-            };
-
-            if(!enoughEpochs())
-              continue;
+          auto enoughEpochs = [&]()
+          {
+            // count epochs with observations
+            UInt countEpochs = 0;
+            for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+              if(recv->useable(idEpoch))
+                countEpochs++;
+            return (countEpochs*recv->observationSampling >= minEstimableEpochsRatio*times.size()*medianSampling(times).seconds());
+          };
+
+          if(!enoughEpochs())
+            continue;
 
-            // clock file
-            // ----------
-            if(!fileNameClock.empty())
+          // clock file
+          // ----------
+          if(!fileNameClock.empty())
+          {
+            try
             {
-              try
+              MiscValueArc arc = InstrumentFile::read(fileNameClock(fileNameVariableList));
+              UInt idEpoch = 0;
+              for(UInt arcEpoch=0; arcEpoch<arc.size(); arcEpoch++)
               {
-                MiscValueArc arc = InstrumentFile::read(fileNameClock(fileNameVariableList));
-                UInt idEpoch = 0;
-                for(UInt arcEpoch=0; arcEpoch<arc.size(); arcEpoch++)
-                {
-                  while((idEpoch < recv->times.size()) && (recv->times.at(idEpoch)+timeMargin < arc.at(arcEpoch).time))
-                    recv->disable(idEpoch++, "missing clock data in file");
-                  if(idEpoch >= recv->times.size())
-                    break;
-                  if((arc.at(arcEpoch).time+timeMargin < recv->times.at(idEpoch)) || !recv->useable(idEpoch))
-                    continue;
-                  recv->clk.at(idEpoch++) = arc.at(arcEpoch).value;
-                }
-                for(; idEpoch<times.size(); idEpoch++)
-                  recv->disable(idEpoch, "missing clock data in file");
-
-                recv->preprocessingInfo("readClockFile()");
-                if(!enoughEpochs())
-                {
-                  logWarning<<"Not enough valid epochs in clock file <"<<fileNameClock(fileNameVariableList)<<">, disabling receiver."<<Log::endl;
+                while((idEpoch < recv->times.size()) && (recv->times.at(idEpoch)+timeMargin < arc.at(arcEpoch).time))
+                  recv->disable(idEpoch++, "missing clock data in file");
+                if(idEpoch >= recv->times.size())
+                  break;
+                if((arc.at(arcEpoch).time+timeMargin < recv->times.at(idEpoch)) || !recv->useable(idEpoch))
                   continue;
-                }
+                recv->clk.at(idEpoch++) = arc.at(arcEpoch).value;
               }
-              catch(std::exception &/*e*/)
+              for(; idEpoch<times.size(); idEpoch++)
+                recv->disable(idEpoch, "missing clock data in file");
+
+              recv->preprocessingInfo("readClockFile()");
+              if(!enoughEpochs())
               {
-                logWarning<<"Unable to read clock file <"<<fileNameClock(fileNameVariableList)<<">, disabling receiver."<<Log::endl;
+                logWarning<<"Not enough valid epochs in clock file <"<<fileNameClock(fileNameVariableList)<<">, disabling receiver."<<Log::endl;
                 continue;
               }
             }
-
-            // found valid station
-            receiverAlternative(i) = k+1;
-            break;
-          }
-          catch(std::exception &e)
-          {
-            logWarning<<receiversWithAlternatives.at(i).at(k)->name()<<" disabled: "<<e.what()<<Log::endl;
+            catch(std::exception &/*e*/)
+            {
+              logWarning<<"Unable to read clock file <"<<fileNameClock(fileNameVariableList)<<">, disabling receiver."<<Log::endl;
+              continue;
+            }
           }
+
+          // found valid station
+          alternative.at(i) = k+1;
+          break;
+        }
+        catch(std::exception &e)
+        {
+          logWarning<<receiversWithAlternatives.at(i).at(k)->name()<<" disabled: "<<e.what()<<Log::endl;
         }
       }
+    };
+
+    // concurrent reading of the stations assigned to this process
+    // hardware threads are shared by the processes on the same node
+    const UInt processCountOnNode = Parallel::size(Parallel::nodeCommunicator(comm));
+    const UInt threadCount = std::max(std::min(UInt(std::thread::hardware_concurrency())/processCountOnNode, indexMyRank.size()), UInt(1));
+    std::atomic<UInt>               next(0), finished(0);
+    std::vector<std::exception_ptr> exceptions(threadCount);
+    Log::Timer timer(receiversWithAlternatives.size(), Parallel::size(comm));
+    auto worker = [&](UInt idThread)
+    {
+      try
+      {
+        VariableList variableList = fileNameVariableList;
+        for(UInt idx=next++; idx<indexMyRank.size(); idx=next++)
+        {
+          if(idThread == 0) // only main thread
+            timer.loopStep(Parallel::size(comm)*finished);
+          readReceiver(indexMyRank.at(idx), variableList);
+          finished++;
+        }
+      }
+      catch(...)
+      {
+        exceptions.at(idThread) = std::current_exception();
+      }
+    };
+    std::vector<std::thread> threads;
+    for(UInt idThread=1; idThread<threadCount; idThread++)
+      threads.emplace_back(worker, idThread);
+    worker(0);
+    for(auto &thread : threads)
+      thread.join();
+    Log::flushThreads();
+    for(auto &exception : exceptions)
+      if(exception)
+        std::rethrow_exception(exception);
     Parallel::barrier(comm);
     timer.loopEnd();
+
+    Vector receiverAlternative(alternative.size());
+    for(UInt i=0; i<alternative.size(); i++)
+      receiverAlternative(i) = alternative.at(i);
     Parallel::reduceSum(receiverAlternative, 0, comm);
     Parallel::broadCast(receiverAlternative, 0, comm);
 
@@ -362,6 +576,9 @@ void GnssReceiverGeneratorStationNetwork::preprocessing(Gnss *gnss, Parallel::Co
   {
     logStatus<<"init observations"<<Log::endl;
     VariableList fileNameVariableList;
+    std::string definitionKey;
+    if(!fileNameCache.empty())
+      definitionKey = hashFile(fileNameAntennaDef)+" "+hashFile(fileNameReceiverDef)+" "+hashFile(fileNameAccuracyDef);
     Single::forEach(receivers.size(), [&](UInt idRecv)
     {
       Parallel::peek(comm);
@@ -371,6 +588,25 @@ void GnssReceiverGeneratorStationNetwork::preprocessing(Gnss *gnss, Parallel::Co
         {
           auto recv = receivers.at(idRecv);
           fileNameVariableList.setVariable("station", recv->name());
+
+          // restore the preprocessing of unchanged time segments
+          std::string cacheKey;
+          std::vector<Time> segmentTimes;
+          std::vector<std::string> segmentKeys;
+          Bool isCached = FALSE;
+          if(!fileNameCache.empty())
+          {
+            preprocessingCacheKeys(*recv, *gnss, definitionKey, fileNameVariableList, cacheKey, segmentTimes, segmentKeys);
+            try
+            {
+              isCached = recv->readPreprocessingCache(fileNameCache(fileNameVariableList), cacheKey, segmentTimes, segmentKeys, gnss->transmitters);
+            }
+            catch(std::exception &e)
+            {
+              logWarning<<recv->name()<<": preprocessing cache not used: "<<e.what()<<Log::endl;
+            }
+          }
+
           std::vector<Vector3d> posApriori = recv->pos;
           if(fileNameClock.empty())
             recv->pos = recv->estimateInitialClockErrorFromCodeObservations(gnss->transmitters, gnss->funcRotationCrf2Trf, gnss->funcReduceModels, huber, huberPower, FALSE/*estimateKinematicPosition*/);
@@ -385,6 +621,12 @@ void GnssReceiverGeneratorStationNetwork::preprocessing(Gnss *gnss, Parallel::Co
           recv->removeLowElevationTracks(eqn, elevationTrackMinimum);
           recv->trackOutlierDetection(eqn, {GnssType::L5_G}, huber, huberPower);
           recv->cycleSlipsRepairAtSameFrequency(eqn);
+          if(isCached)
+          {
+            recv->mergePreprocessingCache();
+            if(!fileNameTrackAfter.empty())
+              eqn = GnssReceiver::ObservationEquationList(*recv, gnss->transmitters, gnss->funcRotationCrf2Trf, gnss->funcReduceModels, GnssObservation::RANGE | GnssObservation::PHASE);
+          }
           recv->writeTracks(fileNameTrackAfter, eqn, {GnssType::L5_G});
 
           // count epochs with observations
@@ -394,6 +636,9 @@ void GnssReceiverGeneratorStationNetwork::preprocessing(Gnss *gnss, Parallel::Co
               countEpochs++;
           if(countEpochs*recv->observationSampling < minEstimableEpochsRatio*gnss->times.size()*medianSampling(gnss->times).seconds())
             recv->disable("not enough epochs (< minEstimableEpochsRatio)");
+
+          if(!fileNameCache.empty() && recv->useable())
+            recv->writePreprocessingCache(fileNameCache(fileNameVariableList), cacheKey, segmentTimes, segmentKeys);
         }
         catch(std::exception &e)
         {
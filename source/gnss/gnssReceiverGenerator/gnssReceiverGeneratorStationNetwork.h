@@ -40,6 +40,19 @@ Tidal deformations typically include:
   \item \configClass{poleOceanTide}{tidesType:oceanPoleTide}: ocean pole tidal deformations (IERS conventions)
 \end{itemize}
 
+If \config{preprocessingCache} is set, the preprocessed observations of each station
+(observations, tracks, outlier weights, clock errors, and disabled epochs) are written to this file
+and reused in later runs for unchanged time segments of \config{preprocessingCacheSegmentLength}.
+The file is only used if the station info file, the antenna, receiver, and accuracy definitions,
+the transmitter list, and all preprocessing settings are unchanged.
+A segment is unchanged if its observations, a priori clock errors (\config{inputfileClock}),
+a priori positions including tidal and loading displacements, the transmitter orbits and clocks,
+the earth rotation, and the reduced observations at the first and last observed epoch of the segment
+(containing the models of the \configClass{parametrization}{gnssParametrizationType}) are equal.
+Tracks lying completely in unchanged segments are restored together with the clock errors of these epochs,
+only the remaining observations (e.g. of a new hour in a sliding window) are preprocessed again.
+In this case \config{outputfileTrackBefore} contains the preprocessed tracks only.
+
 )";
 #endif
 
@@ -80,8 +93,13 @@ class GnssReceiverGeneratorStationNetwork : public GnssReceiverGeneratorBase
   UInt                  tecWindowSize;
   Double                tecSigmaFactor;
   FileName              fileNameTrackBefore, fileNameTrackAfter;
+  FileName              fileNameCache;
+  Double                cacheSegmentLength;
   std::vector<GnssReceiverPtr> receivers;
 
+  void preprocessingCacheKeys(const GnssReceiver &recv, const Gnss &gnss, const std::string &definitionKey, const VariableList &fileNameVariableList,
+                              std::string &key, std::vector<Time> &segmentTimes, std::vector<std::string> &segmentKeys) const;
+
 public:
   GnssReceiverGeneratorStationNetwork(Config &config);
 
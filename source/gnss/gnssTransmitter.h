@@ -34,13 +34,14 @@ class GnssTransmitter : public GnssTransceiver
 {
   GnssType                 type; // system + PRN
   Polynomial               polynomial;
+  PolynomialPiecewise3d    polynomialPos, polynomialVel;
   std::vector<Double>      clk;
   std::vector<Vector3d>    offset;   // between CoM and ARF in SRF
   std::vector<Transform3d> crf2srf, srf2arf;
 
 public:
   std::vector<Time> timesPosVel;
-  Matrix            pos, vel; // CoM in CRF (epoch times (x,y,z))
+  Matrix            pos, vel; // CoM in CRF (epoch times (x,y,z)), modify only with updateOrbit()
 
   GnssTransmitter(GnssType prn, const Platform &platform,
                   GnssAntennaDefinition::NoPatternFoundAction noPatternFoundAction,
@@ -49,7 +50,7 @@ public:
                   const std::vector<Time> &timesPosVel, const_MatrixSliceRef position, const_MatrixSliceRef velocity, UInt interpolationDegree)
   : GnssTransceiver(platform, noPatternFoundAction, useableEpochs),
     type(prn), polynomial(timesPosVel, interpolationDegree, TRUE/*throwException*/, FALSE/*leastSquares*/, -(interpolationDegree+1.1), -1.1, 1e-7),
-    clk(clock), offset(offset), crf2srf(crf2srf), srf2arf(srf2arf), timesPosVel(timesPosVel), pos(position), vel(velocity) {}
+    polynomialPos(polynomial, position), polynomialVel(polynomial, velocity), clk(clock), offset(offset), crf2srf(crf2srf), srf2arf(srf2arf), timesPosVel(timesPosVel), pos(position), vel(velocity) {}
 
   /// Destructor.
   virtual ~GnssTransmitter() {}
@@ -78,6 +79,11 @@ public:
   /** @brief velocity in CRF [m/s]. */
   Vector3d velocity(const Time &time) const;
 
+  /** @brief Add corrections to the orbit at @a timesPosVel.
+  * @param dpos position corrections (epochs x (x,y,z))
+  * @param dvel velocity corrections (epochs x (x,y,z)) */
+  void updateOrbit(const_MatrixSliceRef dpos, const_MatrixSliceRef dvel);
+
   /** @brief Rotation from celestial reference frame (CRF) to left-handed antenna system. */
   Transform3d celestial2antennaFrame(UInt idEpoch, const Time &/*time*/) const {return srf2arf.at(idEpoch) * crf2srf.at(idEpoch);}
 };
@@ -88,7 +94,7 @@ inline Vector3d GnssTransmitter::positionCoM(const Time &time) const
 {
   try
   {
-    return Vector3d(polynomial.interpolate({time}, pos));
+    return polynomialPos.interpolate(time);
   }
   catch(std::exception &e)
   {
@@ -102,7 +108,24 @@ inline Vector3d GnssTransmitter::velocity(const Time &time) const
 {
   try
   {
-    return Vector3d(polynomial.interpolate({time}, vel));
+    return polynomialVel.interpolate(time);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline void GnssTransmitter::updateOrbit(const_MatrixSliceRef dpos, const_MatrixSliceRef dvel)
+{
+  try
+  {
+    pos += dpos;
+    vel += dvel;
+    polynomialPos.init(polynomial, pos);
+    polynomialVel.init(polynomial, vel);
   }
   catch(std::exception &e)
   {
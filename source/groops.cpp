@@ -15,7 +15,7 @@
 *
 @verbatim
 Gravity Recovery Object Oriented Programming System (GROOPS)
-Usage: groops [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent] [--global name=value] <configfile.xml>
+Usage: groops [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent] [--global name=value] [--file-cache <MB>] [--profile <profile.json>] <configfile.xml>
        groops --write-settings <groopsDefaults.xml>
        groops --xsd <schemafile.xsd>
        groops --doc <documentation/>
@@ -24,6 +24,8 @@ Usage: groops [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent]
 -l, --log            append messages to logfile. If a directory is given, one time-stamped logfile will be created inside for each groops script.
 -g, --global         pass a global variable to config files as name=value pair
 -c, --settings       read constants from file (default search: groopsDefaults.xml)
+-f, --file-cache     keep parsed static input files (gravity fields, tides, EOP, ...) up to the given size [MB] in memory per process
+-p, --profile        write timing of programs, file access, MPI communication, ... summed up over all processes to JSON file (Chrome trace format)
 -s, --silent         runs silently
 -d, --doc            generate documentation files (latex/html/...)
 -x, --xsd            write xsd-schema of xml-configfile options
@@ -78,6 +80,8 @@ GitHub repository: https://github.com/groops-devs/groops
 #include "programs/program.h"
 #include "inputOutput/settings.h"
 #include "inputOutput/system.h"
+#include "inputOutput/fileCache.h"
+#include "inputOutput/profiler.h"
 #include "config/generateDocumentation.h"
 
 /***********************************************/
@@ -87,7 +91,7 @@ static void groopsHelp(const std::string &progName, Parallel::CommunicatorPtr co
   if(Parallel::isMaster(comm))
   {
     std::cout<<"Gravity Recovery Object Oriented Programming System (GROOPS)"<<std::endl;
-    std::cout<<"Usage: "<<progName<<" [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent] [--global name=value] <configfile.xml>"<<std::endl;
+    std::cout<<"Usage: "<<progName<<" [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent] [--global name=value] [--file-cache <MB>] [--profile <profile.json>] <configfile.xml>"<<std::endl;
     std::cout<<"       "<<progName<<" --write-settings <groopsDefaults.xml>"<<std::endl;
     std::cout<<"       "<<progName<<" --xsd <schemafile.xsd>"<<std::endl;
     std::cout<<"       "<<progName<<" --doc <documentation/>"<<std::endl;
@@ -96,6 +100,8 @@ static void groopsHelp(const std::string &progName, Parallel::CommunicatorPtr co
     std::cout<<" -l, --log            append messages to logfile. If a directory is given, one time-stamped logfile will be created inside for each groops script."<<std::endl;
     std::cout<<" -g, --global         pass a global variable to config files as name=value pair"<<std::endl;
     std::cout<<" -c, --settings       read constants from file (default search: groopsDefaults.xml)"<<std::endl;
+    std::cout<<" -f, --file-cache     keep parsed static input files (gravity fields, tides, EOP, ...) up to the given size [MB] in memory per process"<<std::endl;
+    std::cout<<" -p, --profile        write timing of programs, file access, MPI communication, ... summed up over all processes to JSON file (Chrome trace format)"<<std::endl;
     std::cout<<" -s, --silent         runs silently"<<std::endl;
     std::cout<<" -d, --doc            generate documentation files (latex/html/...)"<<std::endl;
     std::cout<<" -x, --xsd            write xsd-schema of xml-configfile options"<<std::endl;
@@ -151,6 +157,8 @@ int main(int argc, char *argv[])
         else if((opt == "-d") || (opt == "--doc"))            {docFileName           = FileName(optArg());}
         else if((opt == "-c") || (opt == "--settings"))       {settingsFileName      = FileName(optArg());}
         else if((opt == "-C") || (opt == "--write-settings")) {writeSettingsFileName = FileName(optArg());}
+        else if((opt == "-f") || (opt == "--file-cache"))     {FileCache::setMaxSize(static_cast<UInt>(std::stod(optArg())*1024*1024));}
+        else if((opt == "-p") || (opt == "--profile"))        {Profiler::enable(FileName(optArg()));}
         else if((opt == "-s") || (opt == "--silent"))         {silent = TRUE;}
         else if((opt == "-h") || (opt == "--help"))           {groopsHelp(argv[0], comm);}
         else if((opt == "-g") || (opt == "--global"))
@@ -263,6 +271,9 @@ int main(int argc, char *argv[])
       if(!workDone)
         groopsHelp(argv[0], comm);
 
+      if(Profiler::isEnabled())
+        Profiler::write(comm);
+
       Parallel::barrier(comm);
       logStatus<<"=== Finished GROOPS ==="<<Log::endl;
       Parallel::barrier(comm);
@@ -11,9 +11,12 @@
 /***********************************************/
 
 #include "base/importStd.h"
+#include "base/string.h"
 #include "base/doodson.h"
 #include "base/sphericalHarmonics.h"
 #include "base/gnssType.h"
+#include <cstdio>
+#include <cstring>
 #include "archive.h"
 #include "archiveAscii.h"
 
@@ -55,6 +58,15 @@ void OutArchiveAscii::comment(const std::string &text)
 
 void OutArchiveAscii::saveDouble(Double x, Int width, Int precision, Bool science)
 {
+  // formatting without stream overhead, same result
+  char buffer[64];
+  const Int size = std::snprintf(buffer, sizeof(buffer), (science) ? "%*.*e" : "%*.*f", width, precision, x);
+  if((size >= 0) && (size < static_cast<Int>(sizeof(buffer))))
+  {
+    stream.write(buffer, size);
+    return;
+  }
+
   if(science)
     stream.setf(std::ios::scientific,std::ios::floatfield);
   else
@@ -69,7 +81,7 @@ void OutArchiveAscii::saveDouble(Double x, Int width, Int precision, Bool scienc
 
 InArchiveAscii::InArchiveAscii(std::istream &_stream) : stream(_stream), _version(0)
 {
-  stripComments();
+  lineNo = stripComments();
 
   char c;
   stream>>c;
@@ -82,6 +94,7 @@ InArchiveAscii::InArchiveAscii(std::istream &_stream) : stream(_stream), _versio
   std::getline(stream, line);
   if(stream.fail() || line.empty())
     return;
+  lineNo++;
   std::stringstream ss(line);
   std::string text;
   ss>>text;
@@ -108,7 +121,7 @@ InArchiveAscii::InArchiveAscii(std::istream &_stream) : stream(_stream), _versio
 
 /***********************************************/
 
-void InArchiveAscii::stripComments()
+UInt InArchiveAscii::stripComments()
 {
   try
   {
@@ -116,10 +129,10 @@ void InArchiveAscii::stripComments()
     stream>>c;
     stream.putback(c);
     if(c!='#')
-      return;
+      return 0;
     std::string s;
     std::getline(stream, s); // skip rest of line
-    stripComments();
+    return 1 + stripComments();
   }
   catch(std::exception &e)
   {
@@ -133,21 +146,11 @@ Double InArchiveAscii::readDouble(std::istream &stream_)
 {
   try
   {
-    std::string dummy;
-    stream_>>dummy;
-
-    auto dpos = dummy.find_first_of("Dd");
-    if(dpos != std::string::npos)
-      dummy[dpos] = 'e';
-
-    try
-    {
-      return std::stod(dummy);
-    }
-    catch(std::invalid_argument &)
-    {
-      throw(Exception("cannot read number: "+dummy));
-    }
+    stream_>>token;
+    Double x;
+    if(String::parseDouble(token.c_str(), x) == token.c_str())
+      throw(Exception("cannot read number: "+token));
+    return x;
   }
   catch(std::exception &e)
   {
@@ -342,7 +345,7 @@ void InArchiveAscii::load(Matrix &A)
 {
   try
   {
-    stripComments();
+    lineNo += stripComments();
 
     char c;
     stream>>c;
@@ -355,7 +358,7 @@ void InArchiveAscii::load(Matrix &A)
         std::string line;
         try
         {
-          stripComments();
+          lineNo += stripComments() + 1;
           std::getline(stream, line);
         }
         catch(std::exception &e)
@@ -367,15 +370,14 @@ void InArchiveAscii::load(Matrix &A)
         if(line.empty())
           break;
         values.resize(i+1);
-        std::stringstream ss(line);
-        for(;;)
-        {
-          std::string dummy;
-          ss>>dummy;
-          if(ss.fail() || ss.bad() || (dummy.at(0) == '#'))
-            break;
-          values.at(i).push_back(std::stod(dummy));
-        }
+        Double x;
+        const char *ptr = line.c_str();
+        for(const char *end; (end = String::parseDouble(ptr, x)) != ptr; ptr=end)
+          values.at(i).push_back(x);
+        while(std::isspace(static_cast<unsigned char>(*ptr)))
+          ptr++;
+        if(*ptr && (*ptr != '#'))
+          throw(Exception("cannot read number in line "+lineNo%"%i: "s+line));
       }
       A = Matrix(values.size(), values.at(0).size());
       for(UInt i=0; i<A.rows(); i++)
@@ -387,12 +389,37 @@ void InArchiveAscii::load(Matrix &A)
     std::string type;
     UInt rows, columns;
     stream>>type>>rows>>c>>columns>>c;
+    // the values are read line wise (the rows end with a newline)
+    std::string line;
+    const char *ptr = line.c_str();
+    auto readValue = [&]()
+    {
+      for(;;)
+      {
+        Double x;
+        const char *end = String::parseDouble(ptr, x);
+        if(end != ptr)
+        {
+          ptr = end;
+          return x;
+        }
+        while(std::isspace(static_cast<unsigned char>(*ptr)))
+          ptr++;
+        if(*ptr && (*ptr != '#'))
+          throw(Exception("cannot read number: "+line));
+        std::getline(stream, line);
+        if(stream.fail())
+          throw(Exception("unexpected end of file"));
+        ptr = line.c_str();
+      }
+    };
+
     if(type=="Matrix(")
     {
       A = Matrix(rows,columns);
       for(UInt i=0; i<A.rows(); i++)
         for(UInt k=0; k<A.columns(); k++)
-          A(i,k) = readDouble(stream);
+          A(i,k) = readValue();
       return;
     }
 
@@ -410,11 +437,11 @@ void InArchiveAscii::load(Matrix &A)
     if(A.isUpper())
       for(UInt i=0; i<A.rows(); i++)
         for(UInt k=i; k<A.columns(); k++)
-          A(i,k) = readDouble(stream);
+          A(i,k) = readValue();
     else
       for(UInt i=0; i<A.rows(); i++)
         for(UInt k=0; k<=i; k++)
-          A(i,k) = readDouble(stream);
+          A(i,k) = readValue();
   }
   catch(std::exception &e)
   {
@@ -529,20 +556,33 @@ void InArchiveAscii::load(SphericalHarmonics &harm)
       }
       if(line.empty())
         break;
-      std::stringstream ss(line);
-      ss.exceptions(std::ios::badbit|std::ios::failbit);
-      std::string tag;
-      ss>>tag;
-      if((tag != "gfc")&&(tag != "gfct"))
+      const char *ptr = line.c_str();
+      while(std::isspace(static_cast<unsigned char>(*ptr)))
+        ptr++;
+      const char *tag = ptr;
+      while(*ptr && !std::isspace(static_cast<unsigned char>(*ptr)))
+        ptr++;
+      const std::string key(tag, ptr);
+      if((key != "gfc") && (key != "gfct"))
         continue;
-      UInt n,m;
-      ss>>n>>m;
-      cnm(n,m) = readDouble(ss);
-      snm(n,m) = readDouble(ss);
+
+      auto readValue = [&]()
+      {
+        Double x;
+        const char *end = String::parseDouble(ptr, x);
+        if(end == ptr)
+          throw(Exception("cannot read number: "+line));
+        ptr = end;
+        return x;
+      };
+      const UInt n = static_cast<UInt>(readValue());
+      const UInt m = static_cast<UInt>(readValue());
+      cnm(n,m) = readValue();
+      snm(n,m) = readValue();
       if(hasErrors)
       {
-        sigma2cnm(n,m) = std::pow(readDouble(ss), 2);
-        sigma2snm(n,m) = std::pow(readDouble(ss), 2);
+        sigma2cnm(n,m) = std::pow(readValue(), 2);
+        sigma2snm(n,m) = std::pow(readValue(), 2);
       }
     }
 
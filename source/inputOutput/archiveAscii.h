@@ -66,8 +66,10 @@ class InArchiveAscii : public InArchive
   std::istream &stream;
   std::string  typeStr;
   UInt        _version;
+  UInt        lineNo; // lines read for headerless files (error messages)
+  std::string token; // buffer for readDouble
 
-  void stripComments();
+  UInt stripComments(); // returns number of skipped lines
   Double readDouble(std::istream &stream);
 
 public:
@@ -44,6 +44,7 @@ void OutFileArchive::open(const FileName &fileName, const std::string &type, UIn
     close();
     if(fileName.empty())
       return;
+    Profiler::Scope scope("OutFileArchive::open");
 
     // determine format from extension
     const std::string extension = String::upperCase(fileName.typeExtension());
@@ -84,6 +85,7 @@ void OutFileArchive::close()
 {
   if(archive)
   {
+    Profiler::Scope scope("OutFileArchive::close");
     delete archive;
     archive = nullptr;
   }
@@ -122,6 +124,7 @@ void InFileArchive::open(const FileName &fileName, const std::string &typeStr, U
     close();
     if(fileName.empty())
       return;
+    Profiler::Scope scope("InFileArchive::open");
 
     // determine format from extension
     const std::string extension = String::upperCase(fileName.typeExtension());
@@ -16,6 +16,7 @@
 #include "base/exception.h"
 #include "inputOutput/archive.h"
 #include "inputOutput/file.h"
+#include "inputOutput/profiler.h"
 
 /** @addtogroup archiveGroup */
 /// @{
@@ -97,6 +98,7 @@ inline OutFileArchive &OutFileArchive::operator<<(const T &x)
   {
     if(!archive)
       throw(Exception("no file open"));
+    Profiler::Scope scope("OutFileArchive::write");
     (*archive)<<x;
     return *this;
   }
@@ -115,6 +117,7 @@ inline InFileArchive &InFileArchive::operator>>(T &x)
   {
     if(!archive)
       throw(Exception("no file open"));
+    Profiler::Scope scope("InFileArchive::read");
     (*archive)>>x;
     return *this;
   }
@@ -133,6 +136,7 @@ inline InFileArchive &InFileArchive::operator>>(const T &x)
   {
     if(!archive)
       throw(Exception("no file open"));
+    Profiler::Scope scope("InFileArchive::read");
     (*archive)>>x;
     return *this;
   }
@@ -0,0 +1,138 @@
+/***********************************************/
+/**
+* @file fileCache.cpp
+*
+* @brief Process wide cache of parsed files.
+*
+* @author agent
+* @date 2026-10-18
+*
+*/
+/***********************************************/
+
+#include "base/importStd.h"
+#include "inputOutput/system.h"
+#include "inputOutput/fileCache.h"
+#include <map>
+#include <mutex>
+
+/***********************************************/
+
+namespace FileCache
+{
+  class Entry
+  {
+  public:
+    std::string                 key;
+    UInt                        size;
+    Int64                       lastModified;
+    std::shared_ptr<const void> object;
+  };
+
+  static std::mutex       mutex;
+  static UInt             maxSize_ = 0;
+  static UInt             size_    = 0;
+  static std::list<Entry> entries; // most recently used first
+  static std::map<std::string, std::list<Entry>::iterator> index;
+
+  static void removeUntil(UInt size)
+  {
+    while(entries.size() && (size_ > size))
+    {
+      size_ -= entries.back().size;
+      index.erase(entries.back().key);
+      entries.pop_back();
+    }
+  }
+}
+
+/***********************************************/
+
+void FileCache::setMaxSize(UInt size)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  maxSize_ = size;
+  removeUntil(maxSize_);
+}
+
+/***********************************************/
+
+UInt FileCache::maxSize()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return maxSize_;
+}
+
+/***********************************************/
+
+void FileCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  removeUntil(0);
+}
+
+/***********************************************/
+
+std::shared_ptr<const void> FileCache::find(const std::string &type, const FileName &fileName)
+{
+  try
+  {
+    UInt  size;
+    Int64 lastModified;
+    if(!System::fileStatus(fileName, size, lastModified))
+      return nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto iter = index.find(type+"\n"+fileName.str());
+    if(iter == index.end())
+      return nullptr;
+    if((iter->second->size != size) || (iter->second->lastModified != lastModified)) // file changed?
+    {
+      size_ -= iter->second->size;
+      entries.erase(iter->second);
+      index.erase(iter);
+      return nullptr;
+    }
+    entries.splice(entries.begin(), entries, iter->second); // move to front
+    return entries.front().object;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void FileCache::insert(const std::string &type, const FileName &fileName, std::shared_ptr<const void> x)
+{
+  try
+  {
+    Entry entry;
+    entry.key    = type+"\n"+fileName.str();
+    entry.object = x;
+    if(!System::fileStatus(fileName, entry.size, entry.lastModified))
+      return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if(entry.size > maxSize_)
+      return;
+    auto iter = index.find(entry.key);
+    if(iter != index.end())
+    {
+      size_ -= iter->second->size;
+      entries.erase(iter->second);
+      index.erase(iter);
+    }
+    removeUntil(maxSize_-entry.size);
+    size_ += entry.size;
+    entries.push_front(entry);
+    index[entry.key] = entries.begin();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -0,0 +1,83 @@
+/***********************************************/
+/**
+* @file fileCache.h
+*
+* @brief Process wide cache of parsed files.
+*
+* @author agent
+* @date 2026-10-18
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_FILECACHE__
+#define __GROOPS_FILECACHE__
+
+#include "base/importStd.h"
+#include "inputOutput/fileName.h"
+#include <typeinfo>
+
+/** @brief Process wide cache of parsed files.
+* Static input files (gravity field models, ocean tides, EOP, antenna definitions, ...)
+* are often read again in each iteration of a loop (e.g. @a LoopPrograms).
+* The readFile functions of these files store the parsed objects in this cache
+* and return a copy on the next read.
+*
+* Entries are identified by the object type, the file name, the file size, and the time of last modification,
+* so changed files are parsed again. The cache is disabled by default and
+* enabled by setting a memory budget (@a setMaxSize, e.g. by the command line option --file-cache).
+* If the budget is exceeded the least recently used entries are removed.
+* As the memory consumption of the parsed objects is unknown the file size is used as estimate.
+*
+* The returned copies share the memory of matrices (copy on write) with the cached object
+* and are therefore cheap.
+* @ingroup inputOutputGroup */
+namespace FileCache
+{
+  /** @brief Memory budget in bytes (0: cache is disabled). */
+  void setMaxSize(UInt size);
+
+  /** @brief Memory budget in bytes (0: cache is disabled). */
+  UInt maxSize();
+
+  /** @brief Remove all entries. */
+  void clear();
+
+  /** @brief Copy of a cached object.
+  * @return FALSE if @a fileName is not cached with type @a T or has been changed since. */
+  template<typename T> Bool get(const FileName &fileName, T &x);
+
+  /** @brief Stores a copy of a parsed object. */
+  template<typename T> void insert(const FileName &fileName, const T &x);
+
+  // internal functions (type erased)
+  std::shared_ptr<const void> find(const std::string &type, const FileName &fileName);
+  void insert(const std::string &type, const FileName &fileName, std::shared_ptr<const void> x);
+}
+
+/***********************************************/
+/***** INLINES *********************************/
+/***********************************************/
+
+template<typename T> inline Bool FileCache::get(const FileName &fileName, T &x)
+{
+  if(!maxSize())
+    return FALSE;
+  auto ptr = find(typeid(T).name(), fileName);
+  if(!ptr)
+    return FALSE;
+  x = *std::static_pointer_cast<const T>(ptr);
+  return TRUE;
+}
+
+/***********************************************/
+
+template<typename T> inline void FileCache::insert(const FileName &fileName, const T &x)
+{
+  if(maxSize())
+    insert(typeid(T).name(), fileName, std::make_shared<const T>(x));
+}
+
+/***********************************************/
+
+#endif /* __GROOPS_FILECACHE__ */
@@ -11,8 +11,10 @@
 */
 /***********************************************/
 
+#include <thread>
 #include "base/import.h"
 #include "base/string.h"
+#include "parallel/matrixDistributed.h"
 #include "inputOutput/logging.h"
 #include "inputOutput/file.h"
 #include "inputOutput/system.h"
@@ -137,6 +139,8 @@ void writeFileSinex(const FileName &fileName, const Sinex &sinex)
     {
       file<<"+"<<block->label<<std::endl;
       file<<block->ss.str();
+      if(block->stream)
+        block->stream(file);
       file<<"-"<<block->label<<std::endl;
       file<<"*"<<std::string(79, '-')<<std::endl;
     }
@@ -150,7 +154,14 @@ void writeFileSinex(const FileName &fileName, const Sinex &sinex)
 
 /***********************************************/
 
-void readFileSinex(const FileName &fileName, Sinex &sinex)
+static Bool isMatrixBlock(const std::string &label)
+{
+  return String::startsWith(label, "SOLUTION/NORMAL_EQUATION_MATRIX") || String::startsWith(label, "SOLUTION/MATRIX_");
+}
+
+/***********************************************/
+
+void readFileSinex(const FileName &fileName, Sinex &sinex, Bool readMatrices)
 {
   try
   {
@@ -192,7 +203,7 @@ void readFileSinex(const FileName &fileName, Sinex &sinex)
         if(!block || (block->label != "FILE/COMMENT"))
           logWarning<<"Unknown line identifier: '"<<line<<"'"<<Log::endl;
       }
-      else
+      else if(readMatrices || !isMatrixBlock(block->label))
         block->lines.push_back(String::trimRight(line));
     }
   }
@@ -204,6 +215,179 @@ void readFileSinex(const FileName &fileName, Sinex &sinex)
 
 /***********************************************/
 
+Bool readFileSinexMatrix(const FileName &fileName, const std::string &label, MatrixDistributed &N)
+{
+  try
+  {
+    InFile file(fileName);
+
+    // find start of block
+    std::string line;
+    Bool found = FALSE;
+    while(!found && std::getline(file, line))
+      found = String::startsWith(line, "+"+label);
+    if(!found)
+      return FALSE;
+
+    // *PARA1 PARA2 _______PARA2+0_______ _______PARA2+1_______ _______PARA2+2_______
+    struct Element
+    {
+      UInt   row, col, count;
+      Double value[3];
+    };
+
+    const UInt chunkSize   = 100000;
+    const UInt threadCount = std::max(std::min(UInt(std::thread::hardware_concurrency())/Parallel::size(N.communicator()), UInt(16)), UInt(1));
+    std::vector<std::string> lines;
+    std::vector<Element>     elements;
+    Bool isEnd = FALSE;
+    while(!isEnd)
+    {
+      // read next chunk
+      lines.clear();
+      while(lines.size() < chunkSize)
+      {
+        if(!std::getline(file, line) || String::startsWith(line, "-"))
+        {
+          isEnd = TRUE;
+          break;
+        }
+        if(line.size() && (line.at(0) == ' '))
+          lines.push_back(String::trimRight(line));
+      }
+
+      // parse chunk concurrently
+      elements.resize(lines.size());
+      std::vector<std::exception_ptr> exceptions(threadCount);
+      auto parse = [&](UInt idThread)
+      {
+        try
+        {
+          for(UInt i=idThread*lines.size()/threadCount; i<(idThread+1)*lines.size()/threadCount; i++)
+          {
+            const std::string &str = lines.at(i);
+            Element &e = elements.at(i);
+            e.row   = static_cast<UInt>(std::strtoul(str.c_str()+1, nullptr, 10)) - 1;
+            e.col   = static_cast<UInt>(std::strtoul(str.c_str()+7, nullptr, 10)) - 1;
+            e.count = 0;
+            for(UInt l=0; (l<3) && (str.size() >= 13+l*22+21); l++)
+              e.value[e.count++] = std::strtod(str.c_str()+13+l*22, nullptr);
+          }
+        }
+        catch(...)
+        {
+          exceptions.at(idThread) = std::current_exception();
+        }
+      };
+      std::vector<std::thread> threads;
+      for(UInt idThread=1; idThread<threadCount; idThread++)
+        threads.emplace_back(parse, idThread);
+      parse(0);
+      for(auto &thread : threads)
+        thread.join();
+      for(auto &exception : exceptions)
+        if(exception)
+          std::rethrow_exception(exception);
+
+      // distribute to blocks (same order at all processes)
+      for(const Element &e : elements)
+        for(UInt l=0; l<e.count; l++)
+        {
+          UInt row = e.row;
+          UInt col = e.col+l;
+          if(col < row)
+            std::swap(row, col);
+          if(col >= N.parameterCount())
+            throw(Exception("SINEX matrix element ("+(row+1)%"%i, "s+(col+1)%"%i) exceeds dimension "s+N.parameterCount()%"%i"s));
+          const UInt i  = N.index2block(row);
+          const UInt k  = N.index2block(col);
+          if(!N.isBlockUsed(i, k))
+            N.setBlock(i, k);
+          if(N.isMyRank(i, k))
+            N.N(i, k)(row-N.blockIndex(i), col-N.blockIndex(k)) += e.value[l];
+        }
+    }
+
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void writeSinexMatrix(std::ostream &stream, const std::vector<UInt> &blockIndex, const std::function<Matrix(UInt i)> &blockRow)
+{
+  try
+  {
+    const UInt dim         = blockIndex.back();
+    const UInt threadCount = std::max(std::min(UInt(std::thread::hardware_concurrency()), UInt(16)), UInt(1));
+    for(UInt idBlock=0; idBlock+1<blockIndex.size(); idBlock++)
+    {
+      const Matrix N = blockRow(idBlock);
+      if(!N.size())
+        continue;
+      if((N.rows() != blockIndex.at(idBlock+1)-blockIndex.at(idBlock)) || (N.columns() != dim-blockIndex.at(idBlock)))
+        throw(Exception("block row "+idBlock%"%i: dimension error"s));
+
+      // format rows concurrently in chunks
+      std::vector<std::string>        text(threadCount);
+      std::vector<std::exception_ptr> exceptions(threadCount);
+      auto format = [&](UInt idThread)
+      {
+        try
+        {
+          char buffer[32];
+          std::string &str = text.at(idThread);
+          for(UInt r=idThread*N.rows()/threadCount; r<(idThread+1)*N.rows()/threadCount; r++)
+          {
+            const UInt i = blockIndex.at(idBlock)+r;
+            for(UInt c=r; c<N.columns(); c++)
+              if(N(r,c))
+              {
+                std::snprintf(buffer, sizeof(buffer), " %5lu %5lu", static_cast<unsigned long>(i+1), static_cast<unsigned long>(blockIndex.at(idBlock)+c+1));
+                str += buffer;
+                std::snprintf(buffer, sizeof(buffer), " %21.14e", N(r,c));
+                str += buffer;
+                for(UInt l=1; (l<3) && (c+1<N.columns()) && N(r,c+1); l++, c++)
+                {
+                  std::snprintf(buffer, sizeof(buffer), " %21.14e", N(r,c+1));
+                  str += buffer;
+                }
+                str += '\n';
+              }
+          }
+        }
+        catch(...)
+        {
+          exceptions.at(idThread) = std::current_exception();
+        }
+      };
+      std::vector<std::thread> threads;
+      for(UInt idThread=1; idThread<threadCount; idThread++)
+        threads.emplace_back(format, idThread);
+      format(0);
+      for(auto &thread : threads)
+        thread.join();
+      for(auto &exception : exceptions)
+        if(exception)
+          std::rethrow_exception(exception);
+
+      // write in order
+      for(const std::string &str : text)
+        stream<<str;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 template<> Bool readConfig(Config &config, const std::string &name, Sinex &sinex, Config::Appearance mustSet, const std::string &defaultValue, const std::string &annotation)
 {
   try
@@ -22,6 +22,7 @@
 
 /***** TYPES ***********************************/
 
+class MatrixDistributed;
 class SinexBlock;
 typedef std::shared_ptr<SinexBlock> SinexBlockPtr;
 
@@ -53,6 +54,7 @@ public:
   std::string              label;
   std::vector<std::string> lines;
   std::stringstream        ss;
+  std::function<void(std::ostream &)> stream; /// optional content written after ss (e.g. large matrices)
 
   std::ostream &operator<<(std::ostream  &(*pf)(std::ostream  &)) {pf(ss); return ss;} // sinex<<std::endl;
   template<typename T> std::ostream &operator<<(const T &t) {return ss<<t;}
@@ -61,7 +63,24 @@ public:
 /***** FUNCTIONS *******************************/
 
 void writeFileSinex(const FileName &fileName, const Sinex &sinex);
-void readFileSinex(const FileName &fileName, Sinex &sinex);
+
+/** @brief Read SINEX file.
+* If not @a readMatrices the lines of the matrix blocks (SOLUTION/NORMAL_EQUATION_MATRIX, SOLUTION/MATRIX_*)
+* are skipped and only the labels are stored. These blocks can be read with @a readFileSinexMatrix. */
+void readFileSinex(const FileName &fileName, Sinex &sinex, Bool readMatrices=TRUE);
+
+/** @brief Streams the matrix block starting with @a label into the distributed matrix @a N.
+* @a N must be initialized before (e.g. initEmpty). Blocks are set as needed
+* and each process keeps only the elements of its own blocks. Elements of the lower triangle are mirrored
+* to the upper triangle. The lines are parsed in chunks by multiple threads.
+* Must be called by all processes of @a N.
+* @return FALSE if the block is not found in the file. */
+Bool readFileSinexMatrix(const FileName &fileName, const std::string &label, MatrixDistributed &N);
+
+/** @brief Writes the upper triangle of a symmetric matrix as SINEX matrix block content (three values per line).
+* The matrix is processed block row by block row: @a blockRow(i) returns the rows from blockIndex[i] to blockIndex[i+1]-1
+* and the columns from blockIndex[i] to the end. The rows are formatted concurrently in chunks and written in order. */
+void writeSinexMatrix(std::ostream &stream, const std::vector<UInt> &blockIndex, const std::function<Matrix(UInt i)> &blockRow);
 
 template<> Bool readConfig(Config &config, const std::string &name, Sinex &sinex, Config::Appearance mustSet, const std::string &defaultValue, const std::string &annotation);
 
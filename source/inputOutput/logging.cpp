@@ -12,6 +12,8 @@
 /***********************************************/
 
 #include <cassert>
+#include <thread>
+#include <mutex>
 #include "base/import.h"
 #include "base/string.h"
 #include "inputOutput/system.h"
@@ -39,6 +41,17 @@ private:
   std::list<GroupLocal> groupsLocal;
   std::function<void(UInt type, const std::string &str)> send;
 
+  // log lines of worker threads are queued in order and sent by the main thread
+  std::thread::id mainThread;
+  std::mutex      mutexThreads;
+  std::vector<std::pair<Type, std::string>> linesThreads;
+  static thread_local Type              typeThread;
+  static thread_local std::stringstream ssThread;
+
+  Bool isMainThread() const {return std::this_thread::get_id() == mainThread;}
+  void sendLine(Type type, const std::string &str);
+  void sendLinesThreads();
+
   struct Group
   {
     Bool isMain, onScreen, onFile;
@@ -65,6 +78,7 @@ public:
   void setLogFile(const std::string &name);
   void logFilesOnly(Bool enable);
   void currentLogFileOnly(Bool enable);
+  void flushThreads();
 
   std::ostream &startLine(Type type);
   std::ostream &endLine(std::ostream &stream);
@@ -75,9 +89,12 @@ public:
 
 static Logging logging;
 
+thread_local Logging::Type     Logging::typeThread = Logging::STATUS;
+thread_local std::stringstream Logging::ssThread;
+
 /***********************************************/
 
-Logging::Logging() : type(STATUS), groupsLocal({GroupLocal(TRUE, TRUE)}),
+Logging::Logging() : type(STATUS), groupsLocal({GroupLocal(TRUE, TRUE)}), mainThread(std::this_thread::get_id()),
                      rank(0), size(1), newLine(FALSE), groups({std::list<Group>({Group(TRUE, TRUE, TRUE)})})
 {
   send = std::bind(&Logging::receive, this, 0, std::placeholders::_1, std::placeholders::_2);
@@ -134,6 +151,7 @@ Log::GroupPtr Logging::group(Bool isMain, Bool silently)
   try
   {
     assert(groupsLocal.size());
+    sendLinesThreads();
     send(GROUP, (isMain ? "1"s : "0"s) + (!silently ? "1"s : "0"s));
     const Bool mustSendBefore = groupsLocal.front().mustSend;
     groupsLocal.emplace_front(isMain, !silently && mustSendBefore);
@@ -152,6 +170,7 @@ void Logging::removeGroup()
   try
   {
     assert(groupsLocal.size());
+    sendLinesThreads();
     send(REMOVEGROUP, "");
     groupsLocal.pop_front();
   }
@@ -207,6 +226,22 @@ void Logging::currentLogFileOnly(Bool enable)
   }
 }
 
+/***********************************************/
+
+void Logging::flushThreads()
+{
+  try
+  {
+    if(!isMainThread())
+      throw(Exception("Log::flushThreads must be called by the main thread"));
+    sendLinesThreads();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -214,6 +249,14 @@ std::ostream &Logging::startLine(Type type_)
 {
   try
   {
+    if(!isMainThread())
+    {
+      ssThread.str("");
+      typeThread = type_;
+      return ssThread;
+    }
+
+    sendLinesThreads();
     if(!ss.str().empty())
     {
       endLine(ss);
@@ -236,17 +279,62 @@ std::ostream &Logging::endLine(std::ostream &stream)
 {
   try
   {
+    if(!isMainThread() && (&stream == &ssThread))
+    {
+      // queued until the main thread logs the next time or calls flushThreads
+      std::lock_guard<std::mutex> lock(mutexThreads);
+      linesThreads.emplace_back(typeThread, ssThread.str());
+      ssThread.str("");
+      return stream;
+    }
+
     if(&stream != &ss)
       throw(Exception("Log::endl used with other ostream than log"));
 
+    sendLinesThreads();
+    sendLine(type, ss.str());
+    ss.str("");
+    return stream;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void Logging::sendLine(Type type, const std::string &line)
+{
+  try
+  {
     // send log line to main process
     assert(groupsLocal.size());
     if((groupsLocal.front().isMain && (groupsLocal.front().mustSend || (type == WARNINGONCE))) || (type == WARNING) || (type == ERROR))
-      for(const std::string &str :  String::split(ss.str(), '\n'))
+      for(const std::string &str :  String::split(line, '\n'))
         send(type, str);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-    ss.str("");
-    return stream;
+/***********************************************/
+
+void Logging::sendLinesThreads()
+{
+  try
+  {
+    if(!isMainThread())
+      return;
+    std::vector<std::pair<Type, std::string>> lines;
+    {
+      std::lock_guard<std::mutex> lock(mutexThreads);
+      std::swap(lines, linesThreads);
+    }
+    for(const auto &line : lines)
+      sendLine(line.first, line.second);
   }
   catch(std::exception &e)
   {
@@ -422,6 +510,7 @@ Log::GroupPtr Log::group(Bool isMain, Bool silently) {return logging.group(isMai
 void Log::setLogFile(const std::string &name)        {logging.setLogFile(name);}
 void Log::logFilesOnly(Bool enable)                  {logging.logFilesOnly(enable);}
 void Log::currentLogFileOnly(Bool enable)            {logging.currentLogFileOnly(enable);}
+void Log::flushThreads()                             {logging.flushThreads();}
 std::ostream &Log::status()                          {return logging.startLine(Logging::STATUS);}
 std::ostream &Log::info()                            {return logging.startLine(Logging::INFO);}
 std::ostream &Log::warningOnce()                     {return logging.startLine(Logging::WARNINGONCE);}
@@ -10,6 +10,9 @@
 * Only outputs from the main process are printed.
 * Next to logStatus there are also logInfo, logWarning, logError.
 * IMPORTANT: Each output must end with Log::endl.
+* Outputs of additional threads are queued in order and forwarded
+* with the next output of the main thread. After joining the threads
+* the main thread must call Log::flushThreads().
 *
 * @author Torsten Mayer-Guerr
 * @author Andreas Kvas
@@ -49,6 +52,7 @@ namespace Log
   void setLogFile(const std::string &name);    // set log file for current group (must be called by every process in group)
   void logFilesOnly(Bool enable);              // write only to log file(s) (must be called by every process in group)
   void currentLogFileOnly(Bool enable);        // write only to the current log file in this group (must be called by every process in group)
+  void flushThreads();                         // forward queued outputs of additional threads (must be called by the main thread)
 
   std::ostream &status();
   std::ostream &info();
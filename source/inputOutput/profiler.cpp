@@ -0,0 +1,278 @@
+/***********************************************/
+/**
+* @file profiler.cpp
+*
+* @brief Hierarchical timing of code sections.
+*
+* @author agent
+* @date 2026-10-18
+*
+*/
+/***********************************************/
+
+#include "base/importStd.h"
+#include "base/matrix.h"
+#include "parallel/parallel.h"
+#include "inputOutput/file.h"
+#include "inputOutput/profiler.h"
+#include <map>
+#include <mutex>
+
+/***********************************************/
+
+namespace Profiler
+{
+  std::atomic<Bool> enabled(FALSE);
+
+  class Statistics
+  {
+  public:
+    UInt   count;
+    Double total, min, max; // [s]
+    Statistics() : count(0), total(0), min(std::numeric_limits<Double>::max()), max(0) {}
+    void add(UInt count_, Double total_, Double min_, Double max_) {count += count_; total += total_; min = std::min(min, min_); max = std::max(max, max_);}
+  };
+
+  class Event
+  {
+  public:
+    UInt   idPath, idThread;
+    Double start, duration; // [microseconds]
+  };
+
+  static const UInt maxEventCount = 1000000;
+
+  static std::mutex                        mutex;
+  static FileName                          fileName;
+  static std::chrono::steady_clock::time_point timeStart;
+  static std::vector<std::string>          paths;
+  static std::map<std::string, UInt>       pathIndex;
+  static std::vector<Statistics>           statistics; // for each path
+  static std::map<std::string, UInt>       counters;   // path/name
+  static std::vector<Event>                events;
+  static std::atomic<UInt>                 threadCount(0);
+
+  // open scopes of this thread
+  static thread_local std::vector<UInt> stack;
+  static thread_local UInt idThread = threadCount++;
+
+  static std::string className(const std::type_info &type);
+  static std::string escape(const std::string &str);
+}
+
+/***********************************************/
+
+void Profiler::enable(const FileName &fileName_)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  fileName  = fileName_;
+  timeStart = std::chrono::steady_clock::now();
+  enabled   = TRUE;
+}
+
+/***********************************************/
+
+std::string Profiler::className(const std::type_info &type)
+{
+  // mangled name of a class without namespace: length + name (e.g. 10TidesAstronomical)
+  std::string name = type.name();
+  if(name.compare(0, 6, "class ") == 0)
+    name = name.substr(6);
+  const auto pos = name.find_first_not_of("0123456789");
+  return (pos == std::string::npos) ? name : name.substr(pos);
+}
+
+/***********************************************/
+
+std::string Profiler::escape(const std::string &str)
+{
+  std::string result;
+  for(char c : str)
+    if((c == '"') || (c == '\\'))
+      result += std::string("\\")+c;
+    else if(static_cast<unsigned char>(c) >= 0x20)
+      result += c;
+  return result;
+}
+
+/***********************************************/
+
+Profiler::Scope::Scope(const std::type_info &type) : active(isEnabled())
+{
+  if(active)
+    begin(className(type));
+}
+
+/***********************************************/
+
+void Profiler::Scope::begin(const std::string &name)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::string path = (stack.size()) ? paths.at(stack.back())+"/"+name : name;
+    auto iter = pathIndex.find(path);
+    if(iter == pathIndex.end())
+    {
+      iter = pathIndex.insert({path, paths.size()}).first;
+      paths.push_back(path);
+      statistics.push_back(Statistics());
+    }
+    stack.push_back(iter->second);
+  }
+  start = std::chrono::steady_clock::now();
+}
+
+/***********************************************/
+
+void Profiler::Scope::end()
+{
+  const auto time = std::chrono::steady_clock::now();
+  const Double duration = std::chrono::duration<Double>(time-start).count();
+  std::lock_guard<std::mutex> lock(mutex);
+  statistics.at(stack.back()).add(1, duration, duration, duration);
+  if(events.size() < maxEventCount)
+    events.push_back(Event{stack.back(), idThread, 1e6*std::chrono::duration<Double>(start-timeStart).count(), 1e6*duration});
+  stack.pop_back();
+}
+
+/***********************************************/
+
+void Profiler::count(const char *name, UInt value)
+{
+  if(!isEnabled())
+    return;
+  std::lock_guard<std::mutex> lock(mutex);
+  counters[(stack.size()) ? paths.at(stack.back())+"/"+name : std::string(name)] += value;
+}
+
+/***********************************************/
+
+void Profiler::write(Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    if(!isEnabled())
+      return;
+    enabled = FALSE;
+
+    // local statistics and events as text
+    // -----------------------------------
+    std::string localStatistics, localCounters, localEvents;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for(UInt i=0; i<paths.size(); i++)
+        if(statistics.at(i).count)
+          localStatistics += paths.at(i)+"\t"+statistics.at(i).count%"%i\t"s+statistics.at(i).total%"%.9e\t"s+statistics.at(i).min%"%.9e\t"s+statistics.at(i).max%"%.9e\n"s;
+      for(auto &counter : counters)
+        localCounters += counter.first+"\t"+counter.second%"%i\n"s;
+      UInt allocations, reused, peakBytes;
+      MatrixMemory::statistics(allocations, reused, peakBytes);
+      localCounters += "matrixMemory/allocations\t"+allocations%"%i\n"s;
+      localCounters += "matrixMemory/reused\t"+reused%"%i\n"s;
+      localCounters += "matrixMemory/peakBytes\t"+peakBytes%"%i\n"s;
+      const std::string pid = Parallel::myRank(comm)%"%i"s;
+      for(const Event &event : events)
+      {
+        const std::string &path = paths.at(event.idPath);
+        localEvents += ",\n{\"name\":\""+escape(path.substr(path.rfind('/')+1))+"\",\"cat\":\"groops\",\"ph\":\"X\",\"pid\":"+pid
+                    +",\"tid\":"+event.idThread%"%i"s+",\"ts\":"+event.start%"%.3f"s+",\"dur\":"+event.duration%"%.3f"s
+                    +",\"args\":{\"path\":\""+escape(path)+"\"}}";
+      }
+      if(events.size() >= maxEventCount)
+        logWarning<<"profiler: only the first "<<maxEventCount<<" events are stored"<<Log::endl;
+    }
+
+    // collect at master
+    // -----------------
+    std::map<std::string, Statistics> sumStatistics;
+    std::map<std::string, Double>     maxProcess; // max. total time of a single process
+    std::map<std::string, UInt>       sumCounters;
+    std::vector<std::string>          allEvents;
+    auto addStatistics = [&](const std::string &text, const std::string &textCounters)
+    {
+      std::stringstream ss(text);
+      std::string line;
+      while(std::getline(ss, line))
+      {
+        std::stringstream ssLine(line);
+        std::string path;
+        UInt   count;
+        Double total, min, max;
+        std::getline(ssLine, path, '\t');
+        ssLine>>count>>total>>min>>max;
+        sumStatistics[path].add(count, total, min, max);
+        maxProcess[path] = std::max(maxProcess[path], total);
+      }
+      std::stringstream ssCounters(textCounters);
+      while(std::getline(ssCounters, line))
+      {
+        const auto pos = line.rfind('\t');
+        sumCounters[line.substr(0, pos)] += std::stoul(line.substr(pos+1));
+      }
+    };
+
+    if(Parallel::isMaster(comm))
+    {
+      addStatistics(localStatistics, localCounters);
+      allEvents.push_back(localEvents);
+      for(UInt process=1; process<Parallel::size(comm); process++)
+      {
+        std::string textStatistics, textCounters, textEvents;
+        Parallel::receive(textStatistics, process, comm);
+        Parallel::receive(textCounters,   process, comm);
+        Parallel::receive(textEvents,     process, comm);
+        addStatistics(textStatistics, textCounters);
+        allEvents.push_back(textEvents);
+      }
+    }
+    else
+    {
+      Parallel::send(localStatistics, 0, comm);
+      Parallel::send(localCounters,   0, comm);
+      Parallel::send(localEvents,     0, comm);
+    }
+
+    // write file
+    // ----------
+    if(Parallel::isMaster(comm))
+    {
+      logStatus<<"write profile to <"<<fileName<<">"<<Log::endl;
+      OutFile file(fileName);
+      file<<"{\"displayTimeUnit\":\"ms\",\n\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"groops\"}}";
+      for(const std::string &text : allEvents)
+        file<<text;
+      file<<"],\n\"statistics\":[";
+      Bool first = TRUE;
+      for(auto &stat : sumStatistics)
+      {
+        file<<(first ? "\n" : ",\n")<<"{\"path\":\""<<escape(stat.first)<<"\",\"count\":"<<stat.second.count
+            <<",\"total\":"<<stat.second.total%"%.6f"s<<",\"min\":"<<stat.second.min%"%.6f"s<<",\"max\":"<<stat.second.max%"%.6f"s
+            <<",\"maxProcessTotal\":"<<maxProcess[stat.first]%"%.6f"s<<"}";
+        first = FALSE;
+      }
+      file<<"],\n\"counters\":[";
+      first = TRUE;
+      for(auto &counter : sumCounters)
+      {
+        file<<(first ? "\n" : ",\n")<<"{\"path\":\""<<escape(counter.first)<<"\",\"value\":"<<counter.second<<"}";
+        first = FALSE;
+      }
+      file<<"]}"<<std::endl;
+
+      // summary of top level scopes and most expensive scopes
+      std::vector<std::pair<Double, std::string>> sorted;
+      for(auto &stat : sumStatistics)
+        sorted.push_back({stat.second.total, stat.first});
+      std::sort(sorted.rbegin(), sorted.rend());
+      logInfo<<"  profile (summed up over all processes):"<<Log::endl;
+      for(UInt i=0; i<std::min(sorted.size(), UInt(20)); i++)
+        logInfo<<sorted.at(i).first%"  %10.3f s  "s<<sumStatistics[sorted.at(i).second].count%"%9i x  "s<<sorted.at(i).second<<Log::endl;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
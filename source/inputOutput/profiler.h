@@ -0,0 +1,96 @@
+/***********************************************/
+/**
+* @file profiler.h
+*
+* @brief Hierarchical timing of code sections.
+*
+* @author agent
+* @date 2026-10-18
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_PROFILER__
+#define __GROOPS_PROFILER__
+
+#include "base/importStd.h"
+#include "inputOutput/fileName.h"
+#include <atomic>
+#include <chrono>
+#include <typeinfo>
+
+namespace Parallel
+{
+  class Communicator;
+  typedef std::shared_ptr<Communicator> CommunicatorPtr;
+}
+
+/***** CLASS ***********************************/
+
+/** @brief Hierarchical timing of code sections.
+* Profiling is compiled in but disabled by default (command line option --profile <file.json>).
+* If disabled, a @a Profiler::Scope only checks a flag.
+*
+* A @a Profiler::Scope measures the time from its construction to its destruction.
+* Nested scopes form a hierarchy (e.g. program/class/MPI wait). The times are summed up per
+* path of scope names (thread safe) and additionally the single events are stored (up to a maximum number).
+* At the end @a write sums up the statistics of all processes and writes a JSON file
+* in the Chrome trace format (viewable with chrome://tracing or https://ui.perfetto.dev),
+* the summed up statistics are stored in the element "statistics".
+* The counters include the allocations of matrix memory (see @a MatrixMemory).
+* @ingroup inputOutputGroup */
+namespace Profiler
+{
+  /** @brief Start profiling. The results are written by @a write. */
+  void enable(const FileName &fileName);
+
+  /** @brief Is profiling enabled? */
+  inline Bool isEnabled();
+
+  /** @brief Adds @p value to the counter @p name (e.g. bytes read) within the current scope. */
+  void count(const char *name, UInt value=1);
+
+  /** @brief Sums up the statistics of all processes and writes the result file.
+  * Must be called by every process in @a comm. Profiling is disabled afterwards. */
+  void write(Parallel::CommunicatorPtr comm);
+
+  /** @brief Measures the time from construction to destruction. */
+  class Scope
+  {
+    Bool active;
+    std::chrono::steady_clock::time_point start;
+
+    void begin(const std::string &name);
+    void end();
+
+  public:
+    /** @brief Scope with a @p name. */
+    explicit Scope(const char *name) : active(isEnabled()) {if(active) begin(name);}
+
+    /** @brief Scope with a @p name. */
+    explicit Scope(const std::string &name) : active(isEnabled()) {if(active) begin(name);}
+
+    /** @brief Scope named by the dynamic type of a class (e.g. Tides implementation). */
+    explicit Scope(const std::type_info &type);
+
+   ~Scope() {if(active) end();}
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+  };
+}
+
+/***********************************************/
+/***** INLINES *********************************/
+/***********************************************/
+
+namespace Profiler
+{
+  extern std::atomic<Bool> enabled; // internal
+}
+
+inline Bool Profiler::isEnabled() {return enabled.load(std::memory_order_relaxed);}
+
+/***********************************************/
+
+#endif /* __GROOPS_PROFILER__ */
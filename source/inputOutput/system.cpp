@@ -158,6 +158,24 @@ Bool System::isDirectory(const FileName &fileName)
 
 /***********************************************/
 
+Bool System::fileStatus(const FileName &fileName, UInt &size, Int64 &lastModified)
+{
+  try
+  {
+    if(!fs::is_regular_file(fileName.str()))
+      return FALSE;
+    size         = static_cast<UInt>(fs::file_size(fileName.str()));
+    lastModified = static_cast<Int64>(fs::last_write_time(fileName.str()).time_since_epoch().count());
+    return TRUE;
+  }
+  catch(std::exception &/*e*/)
+  {
+    return FALSE;
+  }
+}
+
+/***********************************************/
+
 FileName System::currentWorkingDirectory()
 {
   return FileName(fs::current_path().string());
@@ -56,6 +56,13 @@ namespace System
   /** @brief Check whether fileName is an existing directory */
   Bool isDirectory(const FileName &fileName);
 
+  /** @brief Size and last modification of a regular file.
+  * @param fileName file to be checked.
+  * @param[out] size in bytes.
+  * @param[out] lastModified time stamp in file system clock ticks (only suitable for comparison).
+  * @return FALSE if @a fileName is not a regular file. */
+  Bool fileStatus(const FileName &fileName, UInt &size, Int64 &lastModified);
+
   /** @brief Current working directory as FileName. */
   FileName currentWorkingDirectory();
 
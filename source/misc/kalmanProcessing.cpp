@@ -286,3 +286,180 @@ std::vector< std::vector< std::vector<Matrix> > > AutoregressiveModelSequence::n
 }
 
 /***********************************************/
+/***********************************************/
+/***********************************************/
+
+void KalmanFilterSquareRoot::init(const_MatrixSliceRef x0, const_MatrixSliceRef P0)
+{
+  try
+  {
+    x = x0;
+    S = P0;
+    S.setType(Matrix::SYMMETRIC);
+    cholesky(S);
+    zeroUnusedTriangle(S);
+    S.setType(Matrix::GENERAL);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void KalmanFilterSquareRoot::predict(Vector &xPredicted, Matrix &W) const
+{
+  try
+  {
+    xPredicted = B*x;
+
+    // P- = Q + B S^T S B^T
+    W = Q;
+    W.setType(Matrix::SYMMETRIC);
+    rankKUpdate(1.0, S*B.trans(), W);
+    cholesky(W);
+    zeroUnusedTriangle(W);
+    W.setType(Matrix::GENERAL);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void KalmanFilterSquareRoot::update(const_MatrixSliceRef N, const_MatrixSliceRef n)
+{
+  try
+  {
+    Vector xPredicted;
+    Matrix W;
+    predict(xPredicted, W);
+    const UInt dim   = W.rows();
+    const UInt count = N.rows();
+
+    // residuals: n - N*x-
+    Vector r(dim);
+    copy(n, r.row(0, count));
+    matMult(-1.0, N, xPredicted.row(0, count), r.row(0, count));
+
+    // factor of the normals N = C^T C (positive semidefinite): C = W_N P^T
+    Matrix WN = N;
+    WN.setType(Matrix::SYMMETRIC);
+    UInt rank;
+    const std::vector<UInt> piv = choleskyPivoting(WN, rank);
+    zeroUnusedTriangle(WN);
+    WN.setType(Matrix::GENERAL);
+
+    // stacked factors [I; C W^T] -> M = I + W N W^T = R^T R
+    Matrix PW(count, dim); // P^T W^T
+    for(UInt i=0; i<count; i++)
+      copy(W.column(piv.at(i)).trans(), PW.row(i));
+    Matrix M = identityMatrix(dim, Matrix::SYMMETRIC);
+    if(rank)
+      rankKUpdate(1.0, WN.row(0, rank)*PW, M);
+    cholesky(M);
+
+    // S = R^-T W
+    S = W;
+    triangularSolve(1.0, M.trans(), S);
+
+    // x+ = x- + S^T S r
+    x = xPredicted;
+    matMult(1.0, S.trans(), S*r, x);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void KalmanFilterSquareRoot::update()
+{
+  try
+  {
+    Vector xPredicted;
+    Matrix W;
+    predict(xPredicted, W);
+    x = xPredicted;
+    S = W;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix KalmanFilterSquareRoot::covariance() const
+{
+  try
+  {
+    Matrix P(S.rows(), Matrix::SYMMETRIC);
+    rankKUpdate(1.0, S, P);
+    fillSymmetric(P);
+    return P;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void KalmanFilterSquareRoot::smoothingStep(const_MatrixSliceRef B, const_MatrixSliceRef Q,
+                                           const_MatrixSliceRef updatedState, const_MatrixSliceRef updatedCovariance,
+                                           Matrix &smoothedState, Matrix &smoothedCovariance)
+{
+  try
+  {
+    // P+ = U^T U
+    Matrix U = updatedCovariance;
+    U.setType(Matrix::SYMMETRIC);
+    cholesky(U);
+    zeroUnusedTriangle(U);
+    U.setType(Matrix::GENERAL);
+
+    // P- = Q + B P+ B^T = W^T W
+    const Matrix UB = U*B.trans();
+    Matrix W = Q;
+    W.setType(Matrix::SYMMETRIC);
+    rankKUpdate(1.0, UB, W);
+    cholesky(W);
+
+    // V = W^-T B P+, smoother gain K = P+ B^T (P-)^-1 = V^T W^-T
+    Matrix V = UB.trans()*U;
+    triangularSolve(1.0, W.trans(), V);
+    Matrix KT = V;
+    triangularSolve(1.0, W, KT);
+
+    // x_s = x+ + K (x_s(t+1) - B x+)
+    Matrix dx = smoothedState - B*updatedState;
+    smoothedState = updatedState;
+    matMult(1.0, KT.trans(), dx, smoothedState);
+
+    // P_s = P+ - K P- K^T + K P_s(t+1) K^T
+    Matrix P = updatedCovariance;
+    P.setType(Matrix::SYMMETRIC);
+    rankKUpdate(-1.0, V, P);
+    smoothedCovariance.setType(Matrix::SYMMETRIC);
+    const Matrix PsKT = smoothedCovariance*KT;
+    Matrix KPsKT(P.rows(), P.columns());
+    matMult(1.0, KT.trans(), PsKT, KPsKT);
+    axpy(1.0, KPsKT, P);
+    fillSymmetric(P);
+    smoothedCovariance = P;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
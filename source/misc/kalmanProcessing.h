@@ -186,6 +186,61 @@ public:
   static AutoregressiveModelSequencePtr create(Config &config, const std::string &name);
 };
 
+/***** CLASS ***********************************/
+
+/** @brief Kalman filter in square root form.
+* The process dynamic is given as AR(1) model @f$ x_t = B x_{t-1} + w_t @f$ with @f$ w_t \sim \mathcal{N}(0, Q) @f$.
+* Observations are given as normal equations @f$ N_t, n_t @f$ which may cover the first parameters of the state only.
+*
+* Instead of explicit inverses of the state covariance matrices only cholesky factors are used.
+* With the predicted covariance @f$ P^-_t = W^TW @f$ and the factor @f$ N_t = C^TC @f$ of the normals
+* (cholesky decomposition with pivoting, positive semidefinite) the update reads
+* @f[ M = \begin{bmatrix} I \\ CW^T \end{bmatrix}^T\begin{bmatrix} I \\ CW^T \end{bmatrix} = I + W N_t W^T = R^TR, \qquad P^+_t = S^TS \quad\text{with}\quad S = R^{-T}W, @f]
+* @f[ x^+_t = x^-_t + S^TS(n_t - N_t x^-_t). @f]
+* As @f$ M \geq I @f$ the decomposition is well conditioned even for (nearly) singular normal equations. */
+class KalmanFilterSquareRoot
+{
+  Matrix B, Q;
+  Vector x;  // updated state
+  Matrix S;  // updated state covariance = S^T S
+
+public:
+  /** @brief Constructor with AR(1) process dynamic. */
+  KalmanFilterSquareRoot(const_MatrixSliceRef B, const_MatrixSliceRef Q) : B(B), Q(Q) {}
+
+  /** @brief Initial state and covariance matrix. */
+  void init(const_MatrixSliceRef x0, const_MatrixSliceRef P0);
+
+  /** @brief Predicted state and cholesky factor @a W of the predicted covariance matrix (@f$ P^- = W^TW @f$). */
+  void predict(Vector &xPredicted, Matrix &W) const;
+
+  /** @brief Prediction and update with the normal equations of the next epoch.
+  * @a N and @a n may have less rows than the state (first parameters). */
+  void update(const_MatrixSliceRef N, const_MatrixSliceRef n);
+
+  /** @brief Prediction without observations. */
+  void update();
+
+  /** @brief Updated state. */
+  const Vector &state() const {return x;}
+
+  /** @brief Factor of the updated state covariance matrix (@f$ P^+ = S^TS @f$). */
+  const Matrix &covarianceFactor() const {return S;}
+
+  /** @brief Updated state covariance matrix (SYMMETRIC). */
+  Matrix covariance() const;
+
+  /** @brief Single backward step of the Rauch-Tung-Striebel smoother.
+  * Given the updated state and covariance of epoch t and the smoothed state and covariance of epoch t+1,
+  * the smoothed state and covariance of epoch t are returned in @a smoothedState and @a smoothedCovariance.
+  * Only cholesky factors are used, no explicit inverse is computed. */
+  static void smoothingStep(const_MatrixSliceRef B, const_MatrixSliceRef Q,
+                            const_MatrixSliceRef updatedState, const_MatrixSliceRef updatedCovariance,
+                            Matrix &smoothedState, Matrix &smoothedCovariance);
+};
+
+/***********************************************/
+
 /** @brief Creates an instance of the class AutoregressiveModelSequence. */
 template<> Bool readConfig(Config &config, const std::string &name, AutoregressiveModelSequence &arModelSequence, Config::Appearance mustSet, const std::string &defaultValue, const std::string &annotation);
 
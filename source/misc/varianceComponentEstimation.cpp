@@ -40,6 +40,21 @@ Matrix Vce::monteCarlo(UInt rows, UInt columns)
 
 /***********************************************/
 
+Double Vce::monteCarloStandardDeviation(const Vector &traceColumns)
+{
+  const UInt count = traceColumns.rows();
+  if(count < 2)
+    return 0.;
+  const Double mean = sum(traceColumns)/count;
+  Double ss = 0;
+  for(UInt k=0; k<count; k++)
+    ss += std::pow(traceColumns(k)-mean, 2);
+  // each column is a single sample scaled by 1/count -> variance of the sum
+  return std::sqrt(count/(count-1.) * ss);
+}
+
+/***********************************************/
+
 Double Vce::standardDeviation(Double ePe, Double redundancy, Double huber, Double huberPower)
 {
   static Double huber_      = NAN;
@@ -26,6 +26,11 @@ namespace Vce
   * The number of @p columns increases the reliability. */
   Matrix monteCarlo(UInt rows, UInt columns);
 
+  /** @brief Standard deviation of a trace estimated with @a monteCarlo vectors.
+  * @p traceColumns contains the contribution of each column of the Monte-Carlo-vectors,
+  * the estimated trace is the sum of all contributions. */
+  Double monteCarloStandardDeviation(const Vector &traceColumns);
+
   /** @brief Estimates the standardDeviation in case of otuliers.
   * The quadratic sum of residuals @p ePe and the @p redundancy are computed with downweigthed data. */
   Double standardDeviation(Double ePe, Double redundancy, Double huber, Double huberPower);
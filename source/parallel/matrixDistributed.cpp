@@ -12,6 +12,7 @@
 /***********************************************/
 
 #include "base/import.h"
+#include "inputOutput/profiler.h"
 #include "parallel/parallel.h"
 #include "matrixDistributed.h"
 
@@ -417,6 +418,7 @@ void MatrixDistributed::reduceSum(Bool timing)
 {
   try
   {
+    Profiler::Scope scope("MatrixDistributed::reduceSum");
     if(Parallel::size(comm)<=1)
       return;
 
@@ -453,6 +455,7 @@ void MatrixDistributed::cholesky(Bool timing, UInt startBlock, UInt countBlock,
   UInt i=0;
   try
   {
+    Profiler::Scope scope("MatrixDistributed::cholesky");
     Log::Timer timer(blockCount()-startBlock, 1, timing);
     for(i=startBlock; i<blockCount(); i++)
       if(blockSize(i))
@@ -611,6 +614,7 @@ void MatrixDistributed::triangularSolve(std::vector<Matrix> &x, UInt startBlock,
 {
   try
   {
+    Profiler::Scope scope("MatrixDistributed::triangularSolve");
     for(UInt i=startBlock+countBlock; i-->startBlock;)
       if(blockSize(i))
       {
@@ -689,6 +693,7 @@ void MatrixDistributed::triangularTransSolve(std::vector<Matrix> &x, UInt startB
 {
   try
   {
+    Profiler::Scope scope("MatrixDistributed::triangularTransSolve");
     for(UInt i=startBlock; i<startBlock+countBlock; i++)
       if(blockSize(i))
       {
@@ -763,6 +768,7 @@ void MatrixDistributed::choleskyInverse(Bool timing, UInt startBlock, UInt count
 {
   try
   {
+    Profiler::Scope scope("MatrixDistributed::choleskyInverse");
     Log::Timer timer(countBlock, 1, timing);
     for(UInt i=startBlock; i<startBlock+countBlock; i++)
       if(blockSize(i))
@@ -858,6 +864,7 @@ void MatrixDistributed::choleskyProduct(Bool timing)
 {
   try
   {
+    Profiler::Scope scope("MatrixDistributed::choleskyProduct");
     Log::Timer timer(blockCount(), 1, timing);
     for(UInt i=0; i<blockCount(); i++)
       if(blockSize(i))
@@ -960,6 +967,7 @@ void MatrixDistributed::cholesky2SparseInverse(Bool timing)
 {
   try
   {
+    Profiler::Scope scope("MatrixDistributed::cholesky2SparseInverse");
     Log::Timer timer(blockCount(), 1, timing);
     for(UInt i=blockCount(); i-->0;)
       if(blockSize(i))
@@ -1060,6 +1068,7 @@ void MatrixDistributed::reorder(const std::vector<UInt> &index, const std::vecto
 {
   try
   {
+    Profiler::Scope scope("MatrixDistributed::reorder");
     if(index.size() != blockIndexNew.back())
       throw(Exception("index and blockIndex do not match."));
 
@@ -1160,6 +1169,79 @@ void MatrixDistributed::reorder(const std::vector<UInt> &index, const std::vecto
 
 /***********************************************/
 
+Bool MatrixDistributed::reorderInPlace(const std::vector<UInt> &index, const std::vector<UInt> &blockIndexNew)
+{
+  try
+  {
+    Profiler::Scope scope("MatrixDistributed::reorderInPlace");
+    if(index.size() != blockIndexNew.back())
+      throw(Exception("index and blockIndex do not match."));
+
+    // old block and start index within old block for each new block
+    const UInt blockCountNew = blockIndexNew.size()-1;
+    std::vector<UInt> blockOld(blockCountNew, NULLINDEX), startOld(blockCountNew, 0);
+    std::vector<std::vector<UInt>> newBlocks(blockCount()); // new blocks within each old block
+    for(UInt b=0; b<blockCountNew; b++)
+    {
+      const UInt start = blockIndexNew.at(b);
+      const UInt size  = blockIndexNew.at(b+1)-start;
+      if(!size || std::all_of(index.begin()+start, index.begin()+start+size, [](UInt i) {return i == NULLINDEX;}))
+        continue; // zero block
+      if(index.at(start) == NULLINDEX)
+        return FALSE;
+      blockOld.at(b) = index2block(index.at(start));
+      startOld.at(b) = index.at(start) - blockIndex(blockOld.at(b));
+      if(startOld.at(b)+size > blockSize(blockOld.at(b)))
+        return FALSE;
+      for(UInt i=1; i<size; i++)
+        if(index.at(start+i) != index.at(start)+i)
+          return FALSE;
+      newBlocks.at(blockOld.at(b)).push_back(b);
+    }
+
+    // ranges within an old block must not overlap
+    for(auto &blocks : newBlocks)
+    {
+      std::sort(blocks.begin(), blocks.end(), [&](UInt a, UInt b) {return startOld.at(a) < startOld.at(b);});
+      for(UInt i=1; i<blocks.size(); i++)
+        if(startOld.at(blocks.at(i-1)) + blockIndexNew.at(blocks.at(i-1)+1)-blockIndexNew.at(blocks.at(i-1)) > startOld.at(blocks.at(i)))
+          return FALSE;
+    }
+
+    MatrixDistributed matrixNew;
+    matrixNew.initEmpty(blockIndexNew, comm, calcRank);
+    for(UInt i=0; i<blockCount(); i++)
+      loopBlockRow(i, {i, blockCount()}, [&](UInt k, UInt ik)
+      {
+        for(UInt p : newBlocks.at(i))
+          for(UInt q : newBlocks.at(k))
+          {
+            if((i == k) && (startOld.at(q) < startOld.at(p)))
+              continue; // lower triangle of diagonal block
+            const UInt pq = matrixNew.setBlock(std::min(p, q), std::max(p, q), _rank[ik]);
+            if(matrixNew.isMyRank(pq))
+            {
+              const_MatrixSliceRef slice(_N[ik].slice(startOld.at(p), startOld.at(q), matrixNew.blockSize(p), matrixNew.blockSize(q)));
+              if(p <= q)
+                copy(slice, matrixNew._N[pq]);
+              else
+                copy(slice, matrixNew._N[pq].trans());
+            }
+          }
+        _N[ik] = Matrix();
+      });
+
+    *this = matrixNew;
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 std::vector<UInt> MatrixDistributed::computeBlockIndex(UInt parameterCount, UInt blockSize)
 {
   if(parameterCount==0)
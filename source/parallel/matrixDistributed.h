@@ -188,6 +188,16 @@ public:
   * @param calcRank: function handler to determine the process rank of block(i,k) (default: block cyclic distribution). */
   void reorder(const std::vector<UInt> &index, const std::vector<UInt> &blockIndex, const std::function<UInt(UInt, UInt, UInt)> &calcRank=nullptr);
 
+  /** @brief Reorder without communication (splitting and permutation of blocks).
+  * Applicable only if each new block is a continuous range within a single original block.
+  * The new blocks are sliced from the original blocks and remain at the same process,
+  * so the distribution is not balanced. Intended for temporary partitioning (e.g. before @a cholesky
+  * of parameters to be eliminated), a subsequent @a reorder redistributes the blocks.
+  * @param index: indices of the original matrix elements in the reordered matrix
+  * @param blockIndex: boundary indices of the sub-blocks.
+  * @return FALSE if not applicable (matrix unchanged). */
+  Bool reorderInPlace(const std::vector<UInt> &index, const std::vector<UInt> &blockIndex);
+
   // =========================================
 
   /** @brief Compute boundary indices for distributed blocks from parameter count and block size.
@@ -197,6 +207,7 @@ public:
   friend class GnssProcessingStep;
   friend class GnssParametrizationAmbiguities;
   friend class SlrProcessingStep;
+  friend class NormalEquation;
 };
 
 //***********************************************/
@@ -58,6 +58,10 @@ namespace Parallel
   /** @brief The communicator that refers to the own process only. */
   CommunicatorPtr selfCommunicator();
 
+  /** @brief Creates a communicator of the processes in @a comm running on the same node (shared memory).
+  * Must be called by every process in @a comm. */
+  CommunicatorPtr nodeCommunicator(CommunicatorPtr comm);
+
   // =========================================================
 
   /** @brief Number of processes. */
@@ -197,6 +201,22 @@ namespace Parallel
   * The different calls are distributed using @a processNo (without master).
   * The result in @a vec is only valid at master. */
   template<typename A, typename T> void forEachProcess(std::vector<A> &vec, T func, const std::vector<UInt> &processNo, CommunicatorPtr comm, Bool timing=TRUE);
+
+  /** @brief Parallelized loop with look ahead.
+  * Calls @a func(i) for every @a i in [0,count) with the dynamic distribution of @a forEach.
+  * Each process requests its next loop number in advance and calls @a prefetch(next)
+  * before @a func(i), e.g. to read the input of the next call in the background.
+  * @return The process number for @a i is returned (valid at master). */
+  template<typename T, typename P> std::vector<UInt> forEachPrefetch(UInt count, T func, P prefetch, CommunicatorPtr comm, Bool timing=TRUE);
+
+  /** @brief Parallelized loop with look ahead.
+  * Calls @a vec[i]=func(i) for every @a i in [0,vec.size()) with the dynamic distribution of @a forEach.
+  * Each process requests its next loop number in advance and calls @a prefetch(next)
+  * before @a func(i), e.g. to read the input of the next call in the background.
+  * At master @a finished(i) is called as soon as @a vec[i] is available (e.g. to write results in the background).
+  * The result in @a vec is only valid at master.
+  * @return The process number for @a i is returned (valid at master). */
+  template<typename A, typename T, typename P, typename F> std::vector<UInt> forEachPrefetch(std::vector<A> &vec, T func, P prefetch, F finished, CommunicatorPtr comm, Bool timing=TRUE);
 } // end namespace Parallel
 
 /***********************************************/
@@ -589,6 +609,181 @@ inline void Parallel::forEachProcess(std::vector<A> &vec, T func, const std::vec
   }
 }
 
+/***********************************************/
+
+template<typename T, typename P>
+inline std::vector<UInt> Parallel::forEachPrefetch(UInt count, T func, P prefetch, CommunicatorPtr comm, Bool timing)
+{
+  try
+  {
+    std::vector<UInt> processNo(count, 0);
+
+    // single process version
+    // ----------------------
+    if(size(comm) < 3)
+    {
+      if(isMaster(comm))
+      {
+        Log::Timer timer(count, 1, timing);
+        if(count)
+          prefetch(0);
+        for(UInt i=0; i<count; i++)
+        {
+          timer.loopStep(i);
+          if(i+1 < count)
+            prefetch(i+1);
+          func(i);
+        }
+        timer.loopEnd();
+      }
+      return processNo;
+    }
+
+    // parallel version
+    // ----------------
+    if(isMaster(comm))
+    {
+      // master distributes the loop numbers, each process has two requests pending
+      UInt process, index;
+      Log::Timer timer(count, size(comm)-1, timing);
+      for(UInt i=0; i<count+2*(size(comm)-1); i++)
+      {
+        receive(process, NULLINDEX, comm); // which process needs work?
+        receive(index,   process, comm);   // loop number computed at process
+        const UInt id = (i < count) ? i : NULLINDEX;
+        send(id, process, comm);           // new loop number to be computed at process (or end signal)
+        if(id != NULLINDEX)
+        {
+          processNo.at(id) = process;
+          timer.loopStep(id);
+        }
+      }
+      timer.loopEnd();
+    }
+    else // clients
+    {
+      for(UInt k=0; k<2; k++)
+      {
+        send(myRank(comm), 0, comm);
+        send(NULLINDEX, 0, comm); // no results computed yet
+      }
+      UInt i, next;
+      receive(i,    0, comm);
+      receive(next, 0, comm);
+      if(i != NULLINDEX)
+        prefetch(i);
+      while(i != NULLINDEX)
+      {
+        if(next != NULLINDEX)
+          prefetch(next);
+        func(i);
+        send(myRank(comm), 0, comm);
+        send(i, 0, comm);
+        i = next;
+        receive(next, 0, comm);
+      }
+    }
+
+    broadCast(processNo, 0, comm);
+    return processNo;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+template<typename A, typename T, typename P, typename F>
+inline std::vector<UInt> Parallel::forEachPrefetch(std::vector<A> &vec, T func, P prefetch, F finished, CommunicatorPtr comm, Bool timing)
+{
+  try
+  {
+    std::vector<UInt> processNo(vec.size(), 0);
+
+    // single process version
+    // ----------------------
+    if(size(comm) < 3)
+    {
+      if(isMaster(comm))
+      {
+        Log::Timer timer(vec.size(), 1, timing);
+        if(vec.size())
+          prefetch(0);
+        for(UInt i=0; i<vec.size(); i++)
+        {
+          timer.loopStep(i);
+          if(i+1 < vec.size())
+            prefetch(i+1);
+          vec[i] = func(i);
+          finished(i);
+        }
+        timer.loopEnd();
+      }
+      return processNo;
+    }
+
+    // parallel version
+    // ----------------
+    if(isMaster(comm))
+    {
+      // master distributes the loop numbers, each process has two requests pending
+      UInt process, index;
+      Log::Timer timer(vec.size(), size(comm)-1, timing);
+      for(UInt i=0; i<vec.size()+2*(size(comm)-1); i++)
+      {
+        receive(process, NULLINDEX, comm); // which process needs work?
+        receive(index,   process, comm);   // loop number computed at process
+        if(index != NULLINDEX)
+        {
+          receive(vec[index], process, comm); // receive result
+          finished(index);
+        }
+        const UInt id = (i < vec.size()) ? i : NULLINDEX;
+        send(id, process, comm);           // new loop number to be computed at process (or end signal)
+        if(id != NULLINDEX)
+        {
+          processNo.at(id) = process;
+          timer.loopStep(id);
+        }
+      }
+      timer.loopEnd();
+    }
+    else // clients
+    {
+      for(UInt k=0; k<2; k++)
+      {
+        send(myRank(comm), 0, comm);
+        send(NULLINDEX, 0, comm); // no results computed yet
+      }
+      UInt i, next;
+      receive(i,    0, comm);
+      receive(next, 0, comm);
+      if(i != NULLINDEX)
+        prefetch(i);
+      while(i != NULLINDEX)
+      {
+        if(next != NULLINDEX)
+          prefetch(next);
+        vec[i] = func(i);
+        send(myRank(comm), 0, comm);
+        send(i, 0, comm);
+        send(vec[i], 0, comm);
+        i = next;
+        receive(next, 0, comm);
+      }
+    }
+
+    broadCast(processNo, 0, comm);
+    return processNo;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -13,6 +13,7 @@
 #include "base/import.h"
 #include "base/string.h"
 #include "base/gnssType.h"
+#include "inputOutput/profiler.h"
 #include "parallel/parallel.h"
 
 // #undef SEEK_SET
@@ -38,6 +39,18 @@ inline void check(int errorcode)
   }
 }
 
+/***********************************************/
+
+// transferred bytes for profiling
+inline void countBytes(UInt count, MPI_Datatype datatype)
+{
+  if(!Profiler::isEnabled())
+    return;
+  int typeSize = 0;
+  MPI_Type_size(datatype, &typeSize);
+  Profiler::count("bytes", count*typeSize);
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -158,6 +171,7 @@ inline void Communicator::wait(MPI_Request &request)
     }
 
     // repeat until our request finished
+    Profiler::Scope scope("MPI wait");
     for(;;)
     {
       std::vector<MPI_Request> requests(1, request);
@@ -289,6 +303,23 @@ CommunicatorPtr selfCommunicator()
   }
 }
 
+/***********************************************/
+
+CommunicatorPtr nodeCommunicator(CommunicatorPtr comm)
+{
+  try
+  {
+    barrier(comm); // check for possible exceptions
+    MPI_Comm commNew;
+    check(MPI_Comm_split_type(comm->comm, MPI_COMM_TYPE_SHARED, static_cast<int>(myRank(comm)), MPI_INFO_NULL, &commNew));
+    return std::make_shared<Communicator>(comm, commNew);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -314,6 +345,7 @@ void barrier(CommunicatorPtr comm)
 {
   try
   {
+    Profiler::Scope scope("Parallel::barrier");
     MPI_Request request;
     check(MPI_Ibarrier(comm->comm, &request));
     comm->wait(request);
@@ -706,6 +738,8 @@ inline void send(const void *buffer, UInt count, MPI_Datatype datatype, UInt pro
 {
   try
   {
+    Profiler::Scope scope("Parallel::send");
+    countBytes(count, datatype);
     MPI_Request request;
     check(MPI_Isend(buffer, count, datatype, process, 17, comm->comm, &request));
     comm->wait(request);
@@ -876,6 +910,8 @@ inline void receive(void *buffer, UInt count, MPI_Datatype datatype, UInt proces
 {
   try
   {
+    Profiler::Scope scope("Parallel::receive");
+    countBytes(count, datatype);
     MPI_Request request;
     check(MPI_Irecv(buffer, count, datatype, ((process!=NULLINDEX) ? process : MPI_ANY_SOURCE), 17, comm->comm, &request));
     comm->wait(request);
@@ -1059,6 +1095,8 @@ inline void broadCast(void *buffer, UInt count, MPI_Datatype datatype, UInt proc
 {
   try
   {
+    Profiler::Scope scope("Parallel::broadCast");
+    countBytes(count, datatype);
     MPI_Request request;
     check(MPI_Ibcast(buffer, count, datatype, process, comm->comm, &request));
     comm->wait(request);
@@ -1240,6 +1278,8 @@ inline void reduce(const void *sendbuf, void *recvbuf, UInt count, MPI_Datatype
 {
   try
   {
+    Profiler::Scope scope("Parallel::reduce");
+    countBytes(count, datatype);
     MPI_Request request;
     check(MPI_Ireduce(sendbuf, recvbuf, count, datatype, op, process, comm->comm, &request));
     comm->wait(request);
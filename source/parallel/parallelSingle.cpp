@@ -29,6 +29,7 @@ std::function<void(UInt type, const std::string &str)> addChannel(const std::fun
 CommunicatorPtr splitCommunicator(UInt /*color*/, UInt /*key*/, CommunicatorPtr /*comm*/) {return nullptr;}
 CommunicatorPtr createCommunicator(std::vector<UInt> /*ranks*/, CommunicatorPtr /*comm*/) {return nullptr;}
 CommunicatorPtr selfCommunicator() {return nullptr;}
+CommunicatorPtr nodeCommunicator(CommunicatorPtr /*comm*/) {return nullptr;}
 UInt myRank(CommunicatorPtr /*comm*/) {return 0;}
 UInt size(CommunicatorPtr /*comm*/)   {return 1;}
 void barrier(CommunicatorPtr /*comm*/) {}
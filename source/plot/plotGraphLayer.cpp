@@ -37,6 +37,8 @@ is given a \configClass{colorbar}{plotColorbarType}
 is required and the color is determined by \config{valueZ}.
 Additionally a vertical error bar can be plotted at each data point with
 size \config{valueErrorBar}.
+Dense lines without symbols and error bars (e.g. long high rate time series)
+are reduced to their min/max envelope at output resolution (\config{dpi}) before plotting.
 
 See \program{Gravityfield2AreaMeanTimeSeries} for an example plot.
 )";
@@ -52,6 +54,7 @@ protected:
 public:
   PlotGraphLayerLinesAndPoints(Config &config);
   Bool requiresColorBar()   const override {return hasZValues;}
+  Bool isDecimationAllowed() const override {return line && !symbol && !hasErrors;}
   std::string scriptEntry() const override;
   std::string legendEntry() const override;
 };
@@ -1284,15 +1287,102 @@ void PlotGraphLayer::getIntervalZ(Bool isLogarithmic, Double minX, Double maxX,
 
 /***********************************************/
 
+void PlotGraphLayer::setResolution(Double minX, Double maxX, Bool isLogarithmic, UInt pixelCount)
+{
+  resolutionMinX          = minX;
+  resolutionMaxX          = maxX;
+  resolutionIsLogarithmic = isLogarithmic;
+  pixelCountX             = pixelCount;
+}
+
+/***********************************************/
+
+std::vector<UInt> PlotGraphLayer::envelopeIndex() const
+{
+  try
+  {
+    auto position = [&](Double x) {return resolutionIsLogarithmic ? std::log10(x) : x;};
+    const Double width = 0.5*(position(resolutionMaxX)-position(resolutionMinX))/pixelCountX; // half pixel
+
+    std::vector<UInt> index, bucket;
+    Double idBucket = 0;
+    auto flush = [&]()
+    {
+      if(!bucket.size())
+        return;
+      std::vector<UInt> keep = {bucket.front(), bucket.back()};
+      for(UInt k=1; k<data.columns(); k++)
+      {
+        UInt idMin = bucket.front();
+        UInt idMax = bucket.front();
+        for(UInt i : bucket)
+        {
+          if(data(i, k) < data(idMin, k)) idMin = i;
+          if(data(i, k) > data(idMax, k)) idMax = i;
+        }
+        keep.push_back(idMin);
+        keep.push_back(idMax);
+      }
+      std::sort(keep.begin(), keep.end());
+      keep.erase(std::unique(keep.begin(), keep.end()), keep.end());
+      index.insert(index.end(), keep.begin(), keep.end());
+      bucket.clear();
+    };
+
+    for(UInt i=0; i<data.rows(); i++)
+    {
+      Bool isValid = !resolutionIsLogarithmic || (data(i, 0) > 0);
+      for(UInt k=0; k<data.columns(); k++)
+        isValid = isValid && !std::isnan(data(i, k));
+      if(!isValid) // keep line breaks
+      {
+        flush();
+        index.push_back(i);
+        continue;
+      }
+      const Double id = std::floor((position(data(i, 0))-position(resolutionMinX))/width);
+      if(bucket.size() && (id != idBucket))
+        flush();
+      idBucket = id;
+      bucket.push_back(i);
+    }
+    flush();
+    return index;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void PlotGraphLayer::writeDataFile(const FileName &workingDirectory, UInt idxLayer, Double /*minX*/, Double /*maxX*/, Double /*minY*/, Double /*maxY*/)
 {
   try
   {
+    // reduce dense lines to the output resolution
+    std::vector<UInt> index;
+    if(isDecimationAllowed() && pixelCountX && (resolutionMaxX > resolutionMinX) && (data.rows() > 4*pixelCountX))
+      index = envelopeIndex();
+    if(index.size() && (index.size() < data.rows()))
+      logInfo<<"  layer "<<idxLayer<<": "<<data.rows()<<" points reduced to "<<index.size()<<" (min/max envelope at output resolution)"<<Log::endl;
+    else
+    {
+      index.resize(data.rows());
+      std::iota(index.begin(), index.end(), 0);
+    }
+
+    // binary table (gmt -bi<columns>d)
+    std::vector<Double> buffer;
+    buffer.reserve(index.size()*data.columns());
+    for(UInt i : index)
+      for(UInt k=0; k<data.columns(); k++)
+        buffer.push_back(data(i, k));
+
     dataFileName = "data."+idxLayer%"%i.dat"s;
     OutFile file(workingDirectory.append(dataFileName), std::ios::out | std::ios::binary);
-    for(UInt i=0; i<data.rows(); i++)
-      for(UInt k=0; k<data.columns(); k++)
-        file.write(reinterpret_cast<char *>(&data(i, k)), sizeof(Double));
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size()*sizeof(Double));
   }
   catch(std::exception &e)
   {
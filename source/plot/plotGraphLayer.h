@@ -47,13 +47,29 @@ protected:
   FileName dataFileName;
   Matrix   data;
   Bool     onSecondAxis;
+  Double   resolutionMinX, resolutionMaxX;
+  Bool     resolutionIsLogarithmic;
+  UInt     pixelCountX;
 
   virtual Double bufferX() const {return 0;}
   virtual Double bufferY() const {return 0;}
 
+  /** @brief Data are plotted as lines only and can be reduced to the min/max envelope at output resolution. */
+  virtual Bool isDecimationAllowed() const {return FALSE;}
+
+  /** @brief Rows of @a data needed to draw the lines at output resolution (see @a setResolution).
+  * Consecutive points within half a pixel column are reduced to the first, the last,
+  * and the points with the minimum and maximum of each data column. Rows with NaN values are kept. */
+  std::vector<UInt> envelopeIndex() const;
+
 public:
+  PlotGraphLayer() : resolutionMinX(0), resolutionMaxX(0), resolutionIsLogarithmic(FALSE), pixelCountX(0) {}
   virtual ~PlotGraphLayer() {}
 
+  /** @brief Output resolution of the x-axis (range of the axis and number of pixels).
+  * Dense lines are reduced to the min/max envelope in @a writeDataFile. */
+  void setResolution(Double minX, Double maxX, Bool isLogarithmic, UInt pixelCount);
+
   Bool drawOnSecondAxis() const {return onSecondAxis;}
   virtual Bool requiresColorBar() const {return FALSE;}
   virtual void getIntervalX(Bool isLogarithmic, Double &minX, Double &maxX) const;
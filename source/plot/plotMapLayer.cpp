@@ -38,6 +38,8 @@ it must be set with \config{increment}. To get a better display together with so
 the grid should be internally \config{resample}d to higher resolution.
 It is assumed that the points of \configFile{inputfileGriddedData}{griddedData} represents centers of grid cells.
 This assumption can be changed with \config{gridlineRegistered} (e.g if the data starts at the north pole).
+Grids much finer than the output resolution (\config{dpi}) are reduced to area weighted block means
+with at least two cells per pixel before plotting.
 )";
 
 class PlotMapLayerGrid : public PlotMapLayer
@@ -52,6 +54,7 @@ class PlotMapLayerGrid : public PlotMapLayer
 public:
   PlotMapLayerGrid(Config &config);
   Bool        requiresColorBar() const override {return TRUE;}
+  void        writeDataFile(const Ellipsoid &ellipsoid, const FileName &workingDirectory, UInt idxLayer) override;
   std::string scriptEntry() const override;
 };
 
@@ -150,6 +153,71 @@ PlotMapLayerGrid::PlotMapLayerGrid(Config &config)
 
 /***********************************************/
 
+void PlotMapLayerGrid::writeDataFile(const Ellipsoid &ellipsoid, const FileName &workingDirectory, UInt idxLayer)
+{
+  try
+  {
+    // at least two grid cells per pixel are kept
+    const UInt factor = (pixelSize > 0) ? static_cast<UInt>(std::floor(pixelSize/(2.*std::max(incrementLon, incrementLat)))) : 0;
+    if(isGridline || (factor < 2) || !points.size())
+    {
+      PlotMapLayer::writeDataFile(ellipsoid, workingDirectory, idxLayer);
+      return;
+    }
+
+    // block means of factor x factor cells
+    // ------------------------------------
+    std::vector<Angle> lon(points.size()), lat(points.size());
+    for(UInt i=0; i<points.size(); i++)
+    {
+      Double h;
+      ellipsoid(points.at(i), lon.at(i), lat.at(i), h);
+    }
+    const Angle  incLon(factor*Double(incrementLon));
+    const Angle  incLat(factor*Double(incrementLat));
+    const Double lon0   = *std::min_element(lon.begin(), lon.end()) - 0.5*incrementLon; // west edge of first cell
+    const Double lat0   = *std::min_element(lat.begin(), lat.end()) - 0.5*incrementLat; // south edge of first cell
+    const UInt   cols   = static_cast<UInt>(std::ceil(2*PI/incLon))+1;
+    const UInt   rows   = static_cast<UInt>(std::ceil(PI/incLat))+1;
+
+    std::map<UInt, std::pair<Double, Double>> blocks; // index -> sum of weights, weighted values
+    for(UInt i=0; i<points.size(); i++)
+      if(!std::isnan(data(i, 0)))
+      {
+        Double dLon = std::fmod(lon.at(i)-lon0, 2*PI);
+        if(dLon < 0)
+          dLon += 2*PI;
+        const UInt   idx    = std::min(static_cast<UInt>(std::floor((lat.at(i)-lat0)/incLat)), rows-1)*cols
+                            + std::min(static_cast<UInt>(std::floor(dLon/incLon)), cols-1);
+        const Double weight = (areas.size() == points.size()) ? areas.at(i) : std::cos(lat.at(i));
+        blocks[idx].first  += weight;
+        blocks[idx].second += weight*data(i, 0);
+      }
+
+    std::vector<Double> buffer;
+    buffer.reserve(3*blocks.size());
+    for(auto &block : blocks)
+    {
+      buffer.push_back(RAD2DEG*std::remainder(lon0+((block.first%cols)+0.5)*incLon, 2*PI));
+      buffer.push_back(RAD2DEG*(lat0+((block.first/cols)+0.5)*incLat));
+      buffer.push_back((block.second.first > 0) ? block.second.second/block.second.first : NAN_EXPR);
+    }
+    logInfo<<"  layer "<<idxLayer<<": "<<points.size()<<" grid points reduced to "<<blocks.size()<<" block means at output resolution"<<Log::endl;
+    incrementLon = incLon;
+    incrementLat = incLat;
+
+    dataFileName = "data."+idxLayer%"%i.dat"s;
+    OutFile file(workingDirectory.append(dataFileName), std::ios::out | std::ios::binary);
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size()*sizeof(Double));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 std::string PlotMapLayerGrid::scriptEntry() const
 {
   try
@@ -1081,18 +1149,23 @@ void PlotMapLayer::writeDataFile(const Ellipsoid &ellipsoid, const FileName &wor
     if(!points.size())
       return;
 
-    dataFileName = "data."+idxLayer%"%i.dat"s;
-    OutFile file(workingDirectory.append(dataFileName), std::ios::out | std::ios::binary);
+    // binary table (gmt -bi<columns>d)
+    std::vector<Double> buffer;
+    buffer.reserve(points.size()*(2+data.columns()));
     for(UInt i=0; i<points.size(); i++)
     {
       Angle  lon, lat;
       Double h;
       ellipsoid(points.at(i), lon, lat, h);
-      std::vector<Double> line = {lon*RAD2DEG, lat*RAD2DEG};
-      file.write(reinterpret_cast<char*>(line.data()), line.size()*sizeof(Double));
+      buffer.push_back(lon*RAD2DEG);
+      buffer.push_back(lat*RAD2DEG);
       for(UInt k=0; k<data.columns(); k++)
-        file.write(reinterpret_cast<char*>(&data(i, k)), sizeof(Double));
+        buffer.push_back(data(i, k));
     }
+
+    dataFileName = "data."+idxLayer%"%i.dat"s;
+    OutFile file(workingDirectory.append(dataFileName), std::ios::out | std::ios::binary);
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size()*sizeof(Double));
   }
   catch(std::exception &e)
   {
@@ -47,10 +47,16 @@ protected:
   std::vector<Double>   areas;
   Matrix                data;
   Angle                 bufferLon, bufferLat;
+  Angle                 pixelSize;
 
 public:
+  PlotMapLayer() : pixelSize(0.) {}
   virtual ~PlotMapLayer() {}
 
+  /** @brief Approximate angular size of an output pixel (0: unknown).
+  * Grids much finer than the output resolution are reduced by block means in @a writeDataFile. */
+  void setResolution(Angle pixelSize_) {pixelSize = pixelSize_;}
+
   virtual Bool requiresColorBar() const {return FALSE;}
   virtual void boundary(const Ellipsoid &ellipsoid, Angle &minL, Angle &maxL, Angle &minB, Angle &maxB) const;
   virtual void getIntervalZ(Bool isLogarithmic, Double &minZ, Double &maxZ) const;
@@ -170,14 +170,14 @@ void RinexObservation2GnssReceiver::run(Config &config, Parallel::CommunicatorPt
       compactRinexVersion = 0;
       if(testLabel(label, "CRINEX VERS   / TYPE"))
       {
-        compactRinexVersion = String::toDouble(line.substr(0, 20));
+        compactRinexVersion = String::toDouble(line, 0, 20);
         getLine(file, line, label);
         testLabel(label, "CRINEX PROG / DATE", FALSE);
         getLine(file, line, label);
       }
 
       testLabel(label, "RINEX VERSION / TYPE", FALSE);
-      rinexVersion = String::toDouble(line.substr(0, 9));
+      rinexVersion = String::toDouble(line, 0, 9);
       if(rinexVersion<2)
         throw(Exception("Can only read RINEX files starting from RINEX version 2.0"));
       if(line.at(20)!='O')
@@ -330,8 +330,8 @@ void RinexObservation2GnssReceiver::readHeader(InFile &file, UInt lineCount)
       // ====================================
       else if(testLabel(label, "WAVELENGTH FACT L1/2"))
       {
-        Double factorL1 = String::toInt(line.substr(0, 6));
-        Double factorL2 = String::toInt(line.substr(6, 6));
+        Double factorL1 = String::toInt(line, 0, 6);
+        Double factorL2 = String::toInt(line, 6, 6);
         if((factorL1!=1)||(factorL2!=1))
         {
           logInfo<<"'"<<line<<"'"<<Log::endl;
@@ -343,7 +343,7 @@ void RinexObservation2GnssReceiver::readHeader(InFile &file, UInt lineCount)
               testLabel(label, "SYS / # / OBS TYPES"))   // version 3
       {
         const Char system = line[0] != ' ' ? line[0] : '*';
-        const Int typeCount = String::toInt(line.substr(1, 5));
+        const Int typeCount = String::toInt(line, 1, 5);
 
         std::stringstream ss(line.substr(7,53));
         for(Int i = 0; i < typeCount; i++)
@@ -382,12 +382,12 @@ void RinexObservation2GnssReceiver::readHeader(InFile &file, UInt lineCount)
       // ====================================
       else if(testLabel(label, "TIME OF FIRST OBS"))
       {
-        Int year   = String::toInt(line.substr(0, 6));
-        Int month  = String::toInt(line.substr(6, 6));
-        Int day    = String::toInt(line.substr(12, 6));
-        Int hour   = String::toInt(line.substr(18, 6));
-        Int min    = String::toInt(line.substr(24, 6));
-        Double sec = String::toDouble(line.substr(30, 13));
+        Int year   = String::toInt(line, 0, 6);
+        Int month  = String::toInt(line, 6, 6);
+        Int day    = String::toInt(line, 12, 6);
+        Int hour   = String::toInt(line, 18, 6);
+        Int min    = String::toInt(line, 24, 6);
+        Double sec = String::toDouble(line, 30, 13);
         timeOfFirstObs = date2time(year, month, day, hour, min, sec);
         if((line.substr(48,3)!="   ")&&(line.substr(48,3)!="GPS"))
           logWarning<<"not GPS time"<<Log::endl;
@@ -399,7 +399,7 @@ void RinexObservation2GnssReceiver::readHeader(InFile &file, UInt lineCount)
       // ====================================
       else if(testLabel(label, "RCV CLOCK OFFS APPL"))
       {
-        Int flag = String::toInt(line.substr(0, 6));
+        Int flag = String::toInt(line, 0, 6);
         if(flag!=0)
           logWarning<<"RCV CLOCK OFFS APPL"<<Log::endl;
       }
@@ -416,7 +416,7 @@ void RinexObservation2GnssReceiver::readHeader(InFile &file, UInt lineCount)
       // ====================================
       else if(testLabel(label, "GLONASS SLOT / FRQ #"))
       {
-        const Int satCount = String::toInt(line.substr(0, 3));
+        const Int satCount = String::toInt(line, 0, 3);
 
         std::stringstream ss(line.substr(4,56));
         for(Int i = 0; i < satCount; i++)
@@ -510,8 +510,8 @@ void RinexObservation2GnssReceiver::readObservationData(InFile &file)
         continue;
       }
 
-      const Int  epochFlag = String::toInt(line.substr(rinexVersion < 3 ? 26 : 29, 3));
-      const UInt satCount  = String::toInt(line.substr(rinexVersion < 3 ? 29 : 32, 3));
+      const Int  epochFlag = String::toInt(line, rinexVersion < 3 ? 26 : 29, 3);
+      const UInt satCount  = String::toInt(line, rinexVersion < 3 ? 29 : 32, 3);
 
       // events?
       if((epochFlag>=2)&&(epochFlag!=6))
@@ -521,7 +521,7 @@ void RinexObservation2GnssReceiver::readObservationData(InFile &file)
       }
 
       const Time time = readEpochTime(line);
-      const Double clockOffset = String::toDouble(line.substr(rinexVersion < 3 ? 68 : 41, rinexVersion < 3 ? 12 :15));
+      const Double clockOffset = String::toDouble(line, rinexVersion < 3 ? 68 : 41, rinexVersion < 3 ? 12 :15);
 
       // read observed satellites
       std::vector<GnssType> satNumber(satCount);
@@ -557,7 +557,7 @@ void RinexObservation2GnssReceiver::readObservationData(InFile &file)
         {
           if(idType > 0 && idType%maxObsCountPerLine == 0) // with possible continuation lines
             getLine(file, line, label);
-          obs.at(idSat)(idType) = String::toDouble(line.substr((rinexVersion >= 3 ? 3 : 0)+16*(idType%maxObsCountPerLine), 14));
+          obs.at(idSat)(idType) = String::toDouble(line, (rinexVersion >= 3 ? 3 : 0)+16*(idType%maxObsCountPerLine), 14);
 
           // TODO: LLI and signal strength
         }
@@ -614,8 +614,8 @@ void RinexObservation2GnssReceiver::readCompactObservationData(InFile &file)
         line = epochLine;
       }
 
-      const Int  epochFlag = String::toInt(line.substr(rinexVersion < 3 ? 26 : 29, 3));
-      const UInt satCount  = String::toInt(line.substr(rinexVersion < 3 ? 29 : 32, 3));
+      const Int  epochFlag = String::toInt(line, rinexVersion < 3 ? 26 : 29, 3);
+      const UInt satCount  = String::toInt(line, rinexVersion < 3 ? 29 : 32, 3);
 
       // events?
       if((epochFlag>=2)&&(epochFlag!=6))
@@ -903,12 +903,12 @@ Time RinexObservation2GnssReceiver::readEpochTime(const std::string &line) const
 {
   try
   {
-    Int year   = String::toInt(line.substr(rinexVersion < 3 ?  1 :  2, rinexVersion < 3 ? 2 : 4));
-    Int month  = String::toInt(line.substr(rinexVersion < 3 ?  3 :  7, 3));
-    Int day    = String::toInt(line.substr(rinexVersion < 3 ?  6 : 10, 3));
-    Int hour   = String::toInt(line.substr(rinexVersion < 3 ?  9 : 13, 3));
-    Int minute = String::toInt(line.substr(rinexVersion < 3 ? 12 : 16, 3));
-    Double sec = String::toDouble(line.substr(rinexVersion < 3 ? 15 : 19, 11));
+    Int year   = String::toInt(line, rinexVersion < 3 ?  1 :  2, rinexVersion < 3 ? 2 : 4);
+    Int month  = String::toInt(line, rinexVersion < 3 ?  3 :  7, 3);
+    Int day    = String::toInt(line, rinexVersion < 3 ?  6 : 10, 3);
+    Int hour   = String::toInt(line, rinexVersion < 3 ?  9 : 13, 3);
+    Int minute = String::toInt(line, rinexVersion < 3 ? 12 : 16, 3);
+    Double sec = String::toDouble(line, rinexVersion < 3 ? 15 : 19, 11);
     if(rinexVersion < 3)
       year += (year<80 ? 2000 : 1900);
     return date2time(year, month, day, hour, minute, sec);
@@ -959,7 +959,7 @@ Double RinexObservation2GnssReceiver::readOptionalDouble(const std::string &line
 {
   try
   {
-    return String::toDouble(line.substr(pos, len));
+    return String::toDouble(line, pos, len);
   }
   catch(...)
   {
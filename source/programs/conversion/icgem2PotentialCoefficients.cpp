@@ -99,10 +99,16 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
     auto splitLine = [](const std::string &line)
     {
       std::vector<std::string> tokens;
-      std::stringstream ss(line);
-      std::string token;
-      while(ss >> token)
-        tokens.push_back(token);
+      for(const char *ptr=line.c_str(); *ptr;)
+      {
+        while(std::isspace(static_cast<unsigned char>(*ptr)))
+          ptr++;
+        const char *start = ptr;
+        while(*ptr && !std::isspace(static_cast<unsigned char>(*ptr)))
+          ptr++;
+        if(ptr != start)
+          tokens.emplace_back(start, ptr);
+      }
       return tokens;
     };
 
@@ -171,12 +177,12 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
       if(tokens.size()<5)
         continue;
       UInt offset = 1;
-      UInt n = std::stoul(tokens.at(offset++));
+      UInt n = static_cast<UInt>(String::toInt(tokens.at(offset++)));
       maxDegree = std::max(n, maxDegree);
-      UInt m = std::stoul(tokens.at(offset++));
+      UInt m = static_cast<UInt>(String::toInt(tokens.at(offset++)));
 
-      Double cnm = std::stod(tokens.at(offset++));
-      Double snm = std::stod(tokens.at(offset++));
+      Double cnm = String::toDouble(tokens.at(offset++));
+      Double snm = String::toDouble(tokens.at(offset++));
 
       Double cnm_error = 0.0;
       Double snm_error = 0.0;
@@ -184,13 +190,13 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
       if(hasFormalError && hasCalibratedError)
       {
         if(useFormalErrors) offset += 2;
-        cnm_error = std::stod(tokens.at(offset++));
-        snm_error = std::stod(tokens.at(offset++));
+        cnm_error = String::toDouble(tokens.at(offset++));
+        snm_error = String::toDouble(tokens.at(offset++));
       }
       if(hasFormalError || hasCalibratedError)
       {
-        cnm_error = std::stod(tokens.at(offset++));
-        snm_error = std::stod(tokens.at(offset++));
+        cnm_error = String::toDouble(tokens.at(offset++));
+        snm_error = String::toDouble(tokens.at(offset++));
       }
       Coefficient c(n, m, cnm, snm, cnm_error*cnm_error, snm_error*snm_error);
 
@@ -224,7 +230,7 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
           c.t0 = parseTimeStamp(tokens.at(offset++));
           c.t1 = parseTimeStamp(tokens.at(offset++));
         }
-        c.period = std::stod(tokens.at(offset));
+        c.period = String::toDouble(tokens.at(offset));
       }
       else if(tokens.front() == "asin")
       {
@@ -234,7 +240,7 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
           c.t0 = parseTimeStamp(tokens.at(offset++));
           c.t1 = parseTimeStamp(tokens.at(offset++));
         }
-        c.period = std::stod(tokens.at(offset));
+        c.period = String::toDouble(tokens.at(offset));
       }
       if(!isVersion2)
       {
@@ -86,26 +86,29 @@ void NormalsSphericalHarmonics2Sinex::run(Config &config, Parallel::Communicator
       readFileMatrix(fileNameApriori, x0);
     }
 
-    Matrix N, n;
+    // the normal matrices are not read completely but streamed block row by block row into the SINEX file
+    Matrix n;
     NormalEquationInfo info;
-    logStatus<<"reading normal equation matrix from <"<<fileNameNormals<<">"<<Log::endl;
-    readFileNormalEquation(fileNameNormals, info, N, n);
-    fillSymmetric(N);
-    UInt countParameter = N.rows();
+    logStatus<<"reading normal equation info from <"<<fileNameNormals<<">"<<Log::endl;
+    readFileNormalEquation(fileNameNormals, info, n);
+    UInt countParameter = info.blockIndex.back();
 
-    Matrix dN;
+    NormalEquationInfo infoAprMat;
     std::vector<Bool> parameterIsConstrained(countParameter, FALSE);
     if(!fileNameAprMat.empty())
     {
-      logStatus<<"reading normal equation matrix of applied constraints <"<<fileNameAprMat<<">"<<Log::endl;
+      logStatus<<"reading normal equation info of applied constraints <"<<fileNameAprMat<<">"<<Log::endl;
       Vector n;
-      NormalEquationInfo info;
-      readFileNormalEquation(fileNameAprMat, info, dN, n);
-      fillSymmetric(dN);
-      if(dN.rows() != parameterIsConstrained.size())
-        throw(Exception("Parameter count in constraint matrix and normal equation matrix differs ("+dN.rows()%"%i"s+" vs. "+N.rows()%"%i"s+" )."));
-      for(UInt i=0; i<dN.rows(); i++)
-        parameterIsConstrained.at(i) = (dN(i, i) != 0.0);
+      readFileNormalEquation(fileNameAprMat, infoAprMat, n);
+      if(infoAprMat.blockIndex.back() != parameterIsConstrained.size())
+        throw(Exception("Parameter count in constraint matrix and normal equation matrix differs ("+infoAprMat.blockIndex.back()%"%i"s+" vs. "+countParameter%"%i"s+" )."));
+      for(UInt i=0; i+1<infoAprMat.blockIndex.size(); i++)
+      {
+        Matrix dN;
+        readFileNormalEquation(fileNameAprMat, infoAprMat, i, i, dN);
+        for(UInt k=0; k<dN.rows(); k++)
+          parameterIsConstrained.at(infoAprMat.blockIndex.at(i)+k) = (dN(k, k) != 0.0);
+      }
     }
 
     // ==================================================
@@ -131,17 +134,23 @@ void NormalsSphericalHarmonics2Sinex::run(Config &config, Parallel::Communicator
       }
     };
 
-    auto writeMatrix = [&](SinexBlockPtr block, const Matrix &N)
+    auto writeMatrix = [&](SinexBlockPtr block, const FileName &fileName, const NormalEquationInfo &info)
     {
-      for(UInt i=0; i<N.rows(); i++)
-        for(UInt k=i; k<N.rows(); k++)
-          if(N(i,k))
+      block->stream = [fileName, info](std::ostream &stream)
+      {
+        writeSinexMatrix(stream, info.blockIndex, [&](UInt i)
+        {
+          Matrix N(info.blockIndex.at(i+1)-info.blockIndex.at(i), info.blockIndex.back()-info.blockIndex.at(i));
+          for(UInt k=i; k+1<info.blockIndex.size(); k++)
           {
-            *block<<(i+1)%" %5i"s<<(k+1)%" %5i"s<<N(i, k)%" %21.14e"s;
-            for(UInt l=1; (l<3) && (k+1<N.rows()) && N(i,k+1); l++, k++)
-              *block<<N(i, k+1)%" %21.14e"s;
-            *block<<std::endl;
+            Matrix M;
+            readFileNormalEquation(fileName, info, i, k, M);
+            if(M.size())
+              copy(M, N.column(info.blockIndex.at(k)-info.blockIndex.at(i), M.columns()));
           }
+          return N;
+        });
+      };
     };
 
     // ==================================================
@@ -178,18 +187,18 @@ void NormalsSphericalHarmonics2Sinex::run(Config &config, Parallel::Communicator
       writeVector(block, n);
     }
 
-    if(N.size())
+    if(countParameter)
     {
       SinexBlockPtr block = sinex.addBlock("SOLUTION/NORMAL_EQUATION_MATRIX U");
       *block<<"*PARA1 PARA2 _______PARA2+0_______ _______PARA2+1_______ _______PARA2+2_______"<<std::endl;
-      writeMatrix(block, N);
+      writeMatrix(block, fileNameNormals, info);
     }
 
-    if(dN.size())
+    if(!fileNameAprMat.empty())
     {
       SinexBlockPtr block = sinex.addBlock("SOLUTION/MATRIX_APRIORI U INFO");
       *block<<"*PARA1 PARA2 _______PARA2+0_______ _______PARA2+1_______ _______PARA2+2_______"<<std::endl;
-      writeMatrix(block, dN);
+      writeMatrix(block, fileNameAprMat, infoAprMat);
     }
 
     logStatus<<"write SINEX file <"<<fileNameSinex<<">"<<Log::endl;
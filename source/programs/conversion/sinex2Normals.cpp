@@ -25,6 +25,7 @@ See also \program{GnssNormals2Sinex} and \program{NormalsSphericalHarmonics2Sine
 #include "inputOutput/fileSinex.h"
 #include "files/fileMatrix.h"
 #include "files/fileNormalEquation.h"
+#include "parallel/matrixDistributed.h"
 
 /***** CLASS ***********************************/
 
@@ -33,32 +34,36 @@ See also \program{GnssNormals2Sinex} and \program{NormalsSphericalHarmonics2Sine
 class Sinex2Normals
 {
   Vector readVector(const Sinex &sinex, UInt &dimension, std::vector<ParameterName> &parameterNames, const std::string &label) const;
-  Matrix readMatrix(const Sinex &sinex, UInt dimension, const std::string &label) const;
+  Bool   readMatrix(const FileName &fileName, const Sinex &sinex, const std::string &label, MatrixDistributed &N) const;
+  Vector product(const MatrixDistributed &N, const Vector &x) const;
 
 public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(Sinex2Normals, SINGLEPROCESS, "Convert SINEX to GROOPS normal equations.", Conversion, NormalEquation)
+GROOPS_REGISTER_PROGRAM(Sinex2Normals, PARALLEL, "Convert SINEX to GROOPS normal equations.", Conversion, NormalEquation)
 
 /***********************************************/
 
-void Sinex2Normals::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void Sinex2Normals::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
     FileName outNameNormals, outNameNormalsConstraint, outNameSolutionApriori, outNameSolution, inNameSinex;
+    UInt     blockSize;
 
     readConfig(config, "outputfileNormals",           outNameNormals,           Config::OPTIONAL, "", "N, n: unconstrained normal equations");
     readConfig(config, "outputfileNormalsConstraint", outNameNormalsConstraint, Config::OPTIONAL, "", "N0, n0: normal equations of applied constraints");
     readConfig(config, "outputfileSolution",          outNameSolution,          Config::OPTIONAL, "", "x: parameter vector");
     readConfig(config, "outputfileSolutionApriori",   outNameSolutionApriori,   Config::OPTIONAL, "", "x0: a priori parameter vector");
     readConfig(config, "inputFileSinex",              inNameSinex,              Config::MUSTSET,  "", "");
+    readConfig(config, "outBlockSize",                blockSize,                Config::DEFAULT,  "2048", "block size for distributing the normal equations, 0: one block");
     if(isCreateSchema(config)) return;
 
+    // matrix blocks are streamed later directly into the distributed matrices
     logInfo<<"read SINEX file"<<Log::endl;
     Sinex sinex;
-    readFileSinex(inNameSinex, sinex);
+    readFileSinex(inNameSinex, sinex, FALSE);
 
     // dimension of system of equations
     // --------------------------------
@@ -80,54 +85,70 @@ void Sinex2Normals::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     Vector n  = readVector(sinex, dimension, info.parameterName, "SOLUTION/NORMAL_EQUATION_VECTOR");
     Vector x  = readVector(sinex, dimension, info.parameterName, "SOLUTION/ESTIMATE");
     Vector x0 = readVector(sinex, dimension, info.parameterName, "SOLUTION/APRIORI");
-    Matrix N0 = readMatrix(sinex, dimension, "SOLUTION/MATRIX_APRIORI");
-    Matrix N  = readMatrix(sinex, dimension, "SOLUTION/NORMAL_EQUATION_MATRIX");
+
+    const std::vector<UInt> blockIndex = MatrixDistributed::computeBlockIndex(dimension, blockSize);
+    MatrixDistributed N, N0;
+    N.initEmpty(blockIndex, comm);
+    N0.initEmpty(blockIndex, comm);
+    const Bool hasN0 = readMatrix(inNameSinex, sinex, "SOLUTION/MATRIX_APRIORI", N0);
+    Bool hasN = readMatrix(inNameSinex, sinex, "SOLUTION/NORMAL_EQUATION_MATRIX", N);
 
     // try reconstruct missing information
     if(!x0.size())
       x0 = Vector(x.size());
-    if(!N.size())
+    if(!hasN)
     {
-      N = readMatrix(sinex, dimension, "SOLUTION/MATRIX_ESTIMATE");
-      if(N0.size())
-        N -= N0;
+      hasN = readMatrix(inNameSinex, sinex, "SOLUTION/MATRIX_ESTIMATE", N);
+      if(hasN && hasN0)
+        for(UInt i=0; i<N0.blockCount(); i++)
+          for(UInt k=i; k<N0.blockCount(); k++)
+            if(N0.isBlockUsed(i, k))
+            {
+              if(!N.isBlockUsed(i, k))
+                N.setBlock(i, k);
+              if(N.isMyRank(i, k))
+                axpy(-1., N0.N(i, k), N.N(i, k));
+            }
     }
-    if(!n.size() && N.size())
-      n = N * (x-x0);
+    if(!n.size() && hasN)
+      n = product(N, x-x0);
     if(!info.observationCount)
       info.observationCount = x.size();
-    if(!info.lPl(0))
-      info.lPl = (x-x0).trans()*(N*(x-x0));
+    if(!info.lPl(0) && hasN)
+      info.lPl(0) = inner(x-x0, product(N, x-x0));
 
     // write output files
     // ------------------
-    if(!outNameNormals.empty() && N.size())
+    if(!outNameNormals.empty() && hasN)
     {
       logStatus<<"write unconstrained normal equations to <"<<outNameNormals<<">"<<Log::endl;
-      logInfo<<"  unknown parameters: "<<N.columns()<<Log::endl;
+      logInfo<<"  unknown parameters: "<<N.parameterCount()<<Log::endl;
       logInfo<<"  observations:       "<<info.observationCount<<Log::endl;
       writeFileNormalEquation(outNameNormals, info, N, n);
     }
 
-    if(!outNameNormalsConstraint.empty() && N0.size())
+    if(!outNameNormalsConstraint.empty() && hasN0)
     {
       NormalEquationInfo infoConstraint(info.parameterName);
-        for(UInt i=0; i<N0.rows(); i++)
-          if(N0(i,i))
-            infoConstraint.observationCount++;
+      for(UInt i=0; i<N0.blockCount(); i++)
+        if(N0.isBlockUsed(i, i) && N0.isMyRank(i, i))
+          for(UInt k=0; k<N0.blockSize(i); k++)
+            if(N0.N(i, i)(k, k))
+              infoConstraint.observationCount++;
+      Parallel::reduceSum(infoConstraint.observationCount, 0, comm);
       logStatus<<"write normal equations of applied constraints to <"<<outNameNormalsConstraint<<">"<<Log::endl;
-      logInfo<<"  unknown parameters: "<<N0.columns()<<Log::endl;
+      logInfo<<"  unknown parameters: "<<N0.parameterCount()<<Log::endl;
       logInfo<<"  observations:       "<<infoConstraint.observationCount<<Log::endl;
-      writeFileNormalEquation(outNameNormalsConstraint, infoConstraint, N0, Vector(N0.rows()));
+      writeFileNormalEquation(outNameNormalsConstraint, infoConstraint, N0, Vector(N0.parameterCount()));
     }
 
-    if(!outNameSolution.empty() && x.size())
+    if(Parallel::isMaster(comm) && !outNameSolution.empty() && x.size())
     {
       logStatus<<"write solution vector to <"<<outNameSolution<<">"<<Log::endl;
       writeFileMatrix(outNameSolution, x);
     }
 
-    if(!outNameSolutionApriori.empty() && x0.size())
+    if(Parallel::isMaster(comm) && !outNameSolutionApriori.empty() && x0.size())
     {
       logStatus<<"write a priori solution vector to <"<<outNameSolutionApriori<<">"<<Log::endl;
       writeFileMatrix(outNameSolutionApriori, x0);
@@ -222,41 +243,78 @@ Vector Sinex2Normals::readVector(const Sinex &sinex, UInt &dimension, std::vecto
 
 /***********************************************/
 
-Matrix Sinex2Normals::readMatrix(const Sinex &sinex, UInt dimension, const std::string &label) const
+Bool Sinex2Normals::readMatrix(const FileName &fileName, const Sinex &sinex, const std::string &label, MatrixDistributed &N) const
 {
   try
   {
     auto iter = std::find_if(sinex.blocks.begin(), sinex.blocks.end(), [&](const auto &b) {return String::startsWith(b->label, label);});
     if(iter == sinex.blocks.end())
-      return Matrix();
+      return FALSE;
+    if(!N.parameterCount())
+      throw(Exception("unknown dimension of "+(*iter)->label));
 
-    Matrix N(dimension, dimension);
-    Bool isLower = FALSE;
-    for(auto &line : (*iter)->lines)
-    {
-      const UInt i = static_cast<UInt>(String::toInt(line.substr(1, 5))) - 1;
-      const UInt k = static_cast<UInt>(String::toInt(line.substr(7, 5))) - 1;
-      isLower = isLower || (k < i);
-      for(UInt l=0; l<3; l++)
-        if(line.length() >= 13+l*22+21)
-          N(i,k+l) += String::toDouble(line.substr(13+l*22, 21));
-    }
-    N.setType(Matrix::SYMMETRIC, isLower ? Matrix::LOWER : Matrix::UPPER);
-    fillSymmetric(N);
-    N.setType(Matrix::SYMMETRIC, Matrix::UPPER);
+    logStatus<<"read "<<(*iter)->label<<Log::endl;
+    readFileSinexMatrix(fileName, (*iter)->label, N);
 
     // convert correlation or covariance matrix to normals
     if(String::endsWith((*iter)->label, "CORR"))
     {
-      for(UInt i=1; i<dimension; i++)
-        N.column(0, i-1) *= N(i,i);
-      for(UInt i=0; i<dimension; i++)
-        N.row(i, dimension-i) *= N(i,i);
+      // diagonal contains standard deviations
+      Vector sigma(N.parameterCount());
+      for(UInt i=0; i<N.blockCount(); i++)
+        if(N.isBlockUsed(i, i) && N.isMyRank(i, i))
+          for(UInt k=0; k<N.blockSize(i); k++)
+            sigma(N.blockIndex(i)+k) = N.N(i, i)(k, k);
+      Parallel::reduceSum(sigma, 0, N.communicator());
+      Parallel::broadCast(sigma, 0, N.communicator());
+      for(UInt i=0; i<N.blockCount(); i++)
+        for(UInt k=i; k<N.blockCount(); k++)
+          if(N.isBlockUsed(i, k) && N.isMyRank(i, k))
+            for(UInt z=0; z<N.blockSize(i); z++)
+            {
+              if(i == k)
+                N.N(i, k)(z, z) = std::pow(sigma(N.blockIndex(i)+z), 2); // variance
+              for(UInt s=((i==k) ? z+1 : 0); s<N.blockSize(k); s++)
+                N.N(i, k)(z, s) *= sigma(N.blockIndex(i)+z) * sigma(N.blockIndex(k)+s);
+            }
     }
     if(String::endsWith((*iter)->label, "CORR") || String::endsWith((*iter)->label, "COVA"))
-      inverse(N);
+    {
+      for(UInt i=0; i<N.blockCount(); i++)
+        for(UInt k=i; k<N.blockCount(); k++)
+          if(!N.isBlockUsed(i, k))
+            N.setBlock(i, k);
+      N.cholesky(FALSE);
+      N.choleskyInverse(FALSE);
+      N.choleskyProduct(FALSE);
+    }
+
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-    return N;
+/***********************************************/
+
+Vector Sinex2Normals::product(const MatrixDistributed &N, const Vector &x) const
+{
+  try
+  {
+    Vector y(N.parameterCount());
+    for(UInt i=0; i<N.blockCount(); i++)
+      for(UInt k=i; k<N.blockCount(); k++)
+        if(N.isBlockUsed(i, k) && N.isMyRank(i, k))
+        {
+          matMult(1., N.N(i, k), x.row(N.blockIndex(k), N.blockSize(k)), y.row(N.blockIndex(i), N.blockSize(i)));
+          if(i != k)
+            matMult(1., N.N(i, k).trans(), x.row(N.blockIndex(i), N.blockSize(i)), y.row(N.blockIndex(k), N.blockSize(k)));
+        }
+    Parallel::reduceSum(y, 0, N.communicator());
+    Parallel::broadCast(y, 0, N.communicator());
+    return y;
   }
   catch(std::exception &e)
   {
@@ -107,7 +107,7 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
 
           if(String::startsWith(line, "+"))     // satellite list and orbit accuracy lines
           {
-            if(identifier.empty() && String::toInt(line.substr(3, 3)) > 0)
+            if(identifier.empty() && String::toInt(line, 3, 3) > 0)
               identifier = line.substr(9, 3);
             continue;
           }
@@ -126,12 +126,12 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
           // -----
           if(String::startsWith(line, "* "))
           {
-            UInt   year  = String::toInt(line.substr(3, 4));
-            UInt   month = String::toInt(line.substr(8, 2));
-            UInt   day   = String::toInt(line.substr(11, 2));
-            UInt   hour  = String::toInt(line.substr(14, 2));
-            UInt   min   = String::toInt(line.substr(17, 2));
-            Double sec   = String::toDouble(line.substr(20, 11));
+            UInt   year  = String::toInt(line, 3, 4);
+            UInt   month = String::toInt(line, 8, 2);
+            UInt   day   = String::toInt(line, 11, 2);
+            UInt   hour  = String::toInt(line, 14, 2);
+            UInt   min   = String::toInt(line, 17, 2);
+            Double sec   = String::toDouble(line, 20, 11);
             time = date2time(year, month, day, hour, min, sec);
             if(timeSystem == UTC)
               time = timeUTC2GPS(time);
@@ -154,10 +154,10 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
           if(String::startsWith(line, "P"))
           {
             satId = line.substr(1,3);
-            Double x = String::toDouble(line.substr(4, 14));
-            Double y = String::toDouble(line.substr(18, 14));
-            Double z = String::toDouble(line.substr(32, 14));
-            Double c = String::toDouble(line.substr(46, 14));
+            Double x = String::toDouble(line, 4, 14);
+            Double y = String::toDouble(line, 18, 14);
+            Double z = String::toDouble(line, 32, 14);
+            Double c = String::toDouble(line, 46, 14);
             const Vector3d pos = 1e3*Vector3d(x,y,z); // km -> m
             if(pos.r())
             {
@@ -179,12 +179,12 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
           // -------------------
           if(String::startsWith(line, "EP"))
           {
-            Double xx = String::toDouble(line.substr(4, 4));
-            Double yy = String::toDouble(line.substr(9, 4));
-            Double zz = String::toDouble(line.substr(14, 4));
-            Double xy = String::toDouble(line.substr(27, 8));
-            Double xz = String::toDouble(line.substr(36, 8));
-            Double yz = String::toDouble(line.substr(54, 8));
+            Double xx = String::toDouble(line, 4, 4);
+            Double yy = String::toDouble(line, 9, 4);
+            Double zz = String::toDouble(line, 14, 4);
+            Double xy = String::toDouble(line, 27, 8);
+            Double xz = String::toDouble(line, 36, 8);
+            Double yz = String::toDouble(line, 54, 8);
             Covariance3dEpoch epochCov;
             epochCov.time = time;
             // mm -> m, correlation [1e-7] -> covariance
@@ -198,9 +198,9 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
           if(String::startsWith(line, "V"))
           {
             satId = line.substr(1,3);
-            Double x = String::toDouble(line.substr(4, 14));
-            Double y = String::toDouble(line.substr(18, 14));
-            Double z = String::toDouble(line.substr(32, 14));
+            Double x = String::toDouble(line, 4, 14);
+            Double y = String::toDouble(line, 18, 14);
+            Double z = String::toDouble(line, 32, 14);
             const Vector3d vel = 0.1*Vector3d(x,y,z);  // dm/s -> m/s
             if(vel.r())
               orbits[satId].back().velocity = rotation.rotate(vel) + crossProduct(omega, orbits[satId].back().position);
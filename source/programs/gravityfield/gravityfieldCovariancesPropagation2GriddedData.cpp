@@ -85,23 +85,36 @@ void GravityfieldCovariancesPropagation2GriddedData::run(Config &config, Paralle
     // Compute covariances
     // -------------------
     logStatus<<"calculate covariances on grid"<<Log::endl;
-    std::vector<Double> field(points.size());
-    Parallel::forEach(field, [&](UInt i) {return gravityfield->covariance(time, point0, points.at(i), *kernel);}, comm);
+    // blocks of points -> matrix-matrix operations with a factor of the covariance matrix
+    const UInt blockSize = 100;
+    std::vector<Vector> covariances((points.size()+blockSize-1)/blockSize);
+    Parallel::forEach(covariances, [&](UInt i)
+    {
+      return gravityfield->covariances(time, point0, {points.begin()+i*blockSize, points.begin()+std::min((i+1)*blockSize, points.size())}, *kernel);
+    }, comm);
 
-    std::vector<Double> sigma(points.size());
+    std::vector<Vector> variances;
     if(calcCorrelation)
     {
       logStatus<<"calculate standard deviations on grid"<<Log::endl;
-      Parallel::forEach(sigma, [&](UInt i) {return sqrt(gravityfield->variance(time, points.at(i), *kernel));}, comm);
+      variances.resize(covariances.size());
+      Parallel::forEach(variances, [&](UInt i)
+      {
+        return gravityfield->variances(time, {points.begin()+i*blockSize, points.begin()+std::min((i+1)*blockSize, points.size())}, *kernel);
+      }, comm);
     }
 
     if(Parallel::isMaster(comm))
     {
+      std::vector<Double> field(points.size());
+      for(UInt i=0; i<points.size(); i++)
+        field.at(i) = covariances.at(i/blockSize)(i%blockSize);
+
       if(calcCorrelation)
       {
         Double sigma0 = std::sqrt(gravityfield->variance(time, point0, *kernel));
         for(UInt i=0; i<field.size(); i++)
-          field.at(i) /= (sigma0*sigma.at(i));
+          field.at(i) /= (sigma0*std::sqrt(variances.at(i/blockSize)(i%blockSize)));
       }
 
       logStatus<<"save values to file <"<<fileNameGrid<<">"<<Log::endl;
@@ -18,6 +18,9 @@ given by \configClass{kernel}{kernelType}.
 The resulting \file{outputfileGriddedData}{griddedData} contains the standard deviations of the grid
 points.
 
+The points are processed in blocks, which allows an efficient propagation with a
+Cholesky factor of the covariance matrix.
+
 See also \program{Gravityfield2GridCovarianceMatrix}, \program{GravityfieldCovariancesPropagation2GriddedData}.
 )";
 
@@ -69,11 +72,20 @@ void GravityfieldVariancesPropagation2GriddedData::run(Config &config, Parallel:
     logStatus<<"calculate standard deviations on grid"<<Log::endl;
     std::vector<Vector3d> points = grid->points();
     std::vector<Double>   areas  = grid->areas();
-    std::vector<Double>   field(points.size());
-    Parallel::forEach(field, [&](UInt i) {return sqrt(gravityfield->variance(time, points.at(i), *kernel));}, comm);
+    // blocks of points -> matrix-matrix operations with a factor of the covariance matrix
+    const UInt blockSize = 100;
+    std::vector<Vector> variances((points.size()+blockSize-1)/blockSize);
+    Parallel::forEach(variances, [&](UInt i)
+    {
+      return gravityfield->variances(time, {points.begin()+i*blockSize, points.begin()+std::min((i+1)*blockSize, points.size())}, *kernel);
+    }, comm);
 
     if(Parallel::isMaster(comm))
     {
+      std::vector<Double> field(points.size());
+      for(UInt i=0; i<points.size(); i++)
+        field.at(i) = std::sqrt(variances.at(i/blockSize)(i%blockSize));
+
       logStatus<<"save values to file <"<<fileNameGrid<<">"<<Log::endl;
       GriddedData griddedData(Ellipsoid(a,f), points, areas, {field});
       writeFileGriddedData(fileNameGrid, griddedData);
@@ -22,6 +22,9 @@ to create the file name for this epoch (see \reference{text parser}{general.pars
 If \configClass{timeSeries}{timeSeriesType} is not set
 the temporal nodal points from the inputfile are used.
 
+The temporal nodes are read on demand and at most \config{nodeCountInMemory} nodes
+(at least the spline support) are kept in memory.
+
 See also \program{GriddedData2GriddedDataTimeSeries}.
 )";
 
@@ -55,6 +58,7 @@ void GriddedDataTimeSeries2GriddedData::run(Config &config, Parallel::Communicat
     FileName      fileNameOut, fileNameIn;
     std::string   nameTime, nameIndex, nameCount;
     TimeSeriesPtr timeSeries;
+    UInt          nodeCountInMemory;
 
     readConfig(config, "outputfilesGriddedData",         fileNameOut, Config::MUSTSET,  "grid_{loopTime:%y-%m}.dat", "for each epoch");
     readConfig(config, "variableLoopTime",               nameTime,    Config::OPTIONAL, "loopTime", "variable with time of each epoch");
@@ -62,10 +66,11 @@ void GriddedDataTimeSeries2GriddedData::run(Config &config, Parallel::Communicat
     readConfig(config, "variableLoopCount",              nameCount,   Config::OPTIONAL, "",         "variable with total number of epochs");
     readConfig(config, "inputfileGriddedDataTimeSeries", fileNameIn,  Config::MUSTSET,  "",         "");
     readConfig(config, "timeSeries",                     timeSeries,  Config::OPTIONAL, "",         "otherwise times from inputfile are used");
+    readConfig(config, "nodeCountInMemory",              nodeCountInMemory, Config::DEFAULT, "0",   "max. number of spline nodes kept in memory (0: spline support only)");
     if(isCreateSchema(config)) return;
 
     logStatus<<"read gridded data time series <"<<fileNameIn<<">"<<Log::endl;
-    InFileGriddedDataTimeSeries file(fileNameIn);
+    InFileGriddedDataTimeSeries file(fileNameIn, nodeCountInMemory);
     GriddedData grid = file.grid();
     MiscGriddedData::printStatistics(grid);
     grid.values = std::vector<std::vector<Double>>(file.dataCount(), std::vector<Double>(grid.points.size()));
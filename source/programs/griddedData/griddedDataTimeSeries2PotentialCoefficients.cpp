@@ -24,6 +24,9 @@ The \configFile{outputfilePotentialCoefficients}{potentialCoefficients}
 of \config{variableLoopTime} and \config{variableLoopIndex}
 (see \reference{text parser}{general.parser:text}).
 
+The temporal nodes are read on demand and at most \config{nodeCountInMemory} nodes
+(at least the spline support) are kept in memory.
+
 See also \program{GriddedData2PotentialCoefficients}.
 )";
 
@@ -65,6 +68,7 @@ void GriddedDataTimeSeries2PotentialCoefficients::run(Config &config, Parallel::
     Double                GM, R;
     UInt                  minDegree, maxDegree;
     Bool                  useLeastSquares;
+    UInt                  nodeCountInMemory;
 
     readConfig(config, "outputfilesPotentialCoefficients", fileNameOut,     Config::MUSTSET,  "coeff_{loopTime:%D}.gfc", "for each epoch");
     readConfig(config, "variableLoopTime",                 nameTime,        Config::OPTIONAL, "loopTime", "variable with time of each epoch");
@@ -80,10 +84,11 @@ void GriddedDataTimeSeries2PotentialCoefficients::run(Config &config, Parallel::
     readConfig(config, "GM",                               GM,              Config::DEFAULT,  STRING_DEFAULT_GM, "Geocentric gravitational constant");
     readConfig(config, "R",                                R,               Config::DEFAULT,  STRING_DEFAULT_R,  "reference radius for potential coefficients");
     readConfig(config, "leastSquares",                     useLeastSquares, Config::DEFAULT,  "0",     "false: quadrature formular, true: least squares adjustment order by order");
+    readConfig(config, "nodeCountInMemory",                nodeCountInMemory, Config::DEFAULT, "0",   "max. number of spline nodes kept in memory (0: spline support only)");
     if(isCreateSchema(config)) return;
 
     logStatus<<"read gridded data time series <"<<fileNameIn<<">"<<Log::endl;
-    InFileGriddedDataTimeSeries file(fileNameIn);
+    InFileGriddedDataTimeSeries file(fileNameIn, nodeCountInMemory);
     GriddedData grid = file.grid();
     if(!grid.areas.size())
       grid.computeArea();
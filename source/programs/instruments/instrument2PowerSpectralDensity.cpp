@@ -81,6 +81,7 @@ void Instrument2PowerSpectralDensity::run(Config &config, Parallel::Communicator
     InstrumentFile instrumentFile(fileNameInstrument);
     const UInt arcCount  = instrumentFile.arcCount();
     const UInt dataCount = instrumentFile.dataCount(TRUE/*mustDefined*/);
+    instrumentFile.setReadAhead(3);
 
     Vector freqs;
     UInt   arcEpochCount;
@@ -110,7 +111,7 @@ void Instrument2PowerSpectralDensity::run(Config &config, Parallel::Communicator
 
     logStatus<<"compute PSD"<<Log::endl;
     Matrix PSD(freqs.rows(), dataCount+1);
-    Parallel::forEach(arcCount, [&](UInt arcNo)
+    Parallel::forEachPrefetch(arcCount, [&](UInt arcNo)
     {
       Arc arc = instrumentFile.readArc(arcNo);
       Matrix data = arc.matrix();
@@ -143,7 +144,7 @@ void Instrument2PowerSpectralDensity::run(Config &config, Parallel::Communicator
         for(UInt i=0; i<l.columns(); i++)
           PSD(k, i+1) += lPl(i) - quadsum(l.column(i));
       }
-    }, comm);
+    }, [&](UInt arcNo) {instrumentFile.prefetchArc(arcNo);}, comm);
     Parallel::reduceSum(PSD, 0, comm);
 
     if(Parallel::isMaster(comm))
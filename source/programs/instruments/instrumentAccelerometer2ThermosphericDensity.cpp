@@ -88,6 +88,18 @@ void InstrumentAccelerometer2ThermosphericDensity::run(Config &config, Parallel:
       AccelerometerArc accelerometer = accelerometerFile.readArc(arcNo);
       Arc::checkSynchronized({orbit, starCamera, accelerometer});
 
+      const std::vector<Time> times = orbit.times();
+      std::vector<Vector3d> positions(orbit.size());
+      for(UInt k=0; k<orbit.size(); k++)
+        positions.at(k) = earthRotation->rotaryMatrix(times.at(k)).rotate(orbit.at(k).position);
+      std::vector<Double>   modelDensity, temperature;
+      std::vector<Vector3d> wind;
+      thermosphere->state(times, positions, modelDensity, temperature, wind);
+      if(!useTemperature)
+        std::fill(temperature.begin(), temperature.end(), 0.);
+      if(!useWind)
+        std::fill(wind.begin(), wind.end(), Vector3d());
+
       MiscValueArc output;
       for(UInt k=0; k<orbit.size(); k++)
       {
@@ -106,18 +118,10 @@ void InstrumentAccelerometer2ThermosphericDensity::run(Config &config, Parallel:
           satellite->changeState(time, orbit.at(k).position, orbit.at(k).velocity, positionSun, rotSat, rotEarth);
         }
 
-        Double   modelDensity, temperature;
-        Vector3d wind;
-        thermosphere->state(time, rotEarth.rotate(orbit.at(k).position), modelDensity, temperature, wind);
-        if(!useTemperature)
-         temperature = 0;
-        if(!useWind)
-         wind = Vector3d();
-
         // direction and speed of thermosphere relative to satellite in SRF
-        Vector3d direction = rotSat.inverseRotate(rotEarth.inverseRotate(wind) + crossProduct(omega, orbit.at(k).position) - orbit.at(k).velocity);
+        Vector3d direction = rotSat.inverseRotate(rotEarth.inverseRotate(wind.at(k)) + crossProduct(omega, orbit.at(k).position) - orbit.at(k).velocity);
         const Double v = direction.normalize();
-        const Vector3d acc = (1./satellite->mass) * MiscAccelerationsAtmosphericDrag::force(satellite, direction, v, 1., temperature);
+        const Vector3d acc = (1./satellite->mass) * MiscAccelerationsAtmosphericDrag::force(satellite, direction, v, 1., temperature.at(k));
 
         MiscValueEpoch epoch;
         epoch.time  = time;
@@ -93,6 +93,9 @@ void InstrumentArcCalculate::run(Config &config, Parallel::CommunicatorPtr comm)
     for(UInt i=1; i<file.size(); i++)
       InstrumentFile::checkArcCount({file.at(0), file.at(i)});
 
+    for(UInt i=0; i<file.size(); i++)
+      file.at(i).setReadAhead(3);
+
     // create data variables
     // ---------------------
     VariableList varListGlobal;
@@ -107,7 +110,8 @@ void InstrumentArcCalculate::run(Config &config, Parallel::CommunicatorPtr comm)
     logStatus<<"computing arcs"<<Log::endl;
     std::vector<Arc> arcList(file.at(0).arcCount());
     Matrix statistics(file.at(0).arcCount(), 1+statisticsExpr.size());
-    Parallel::forEach(arcList, [&](UInt arcNo)
+    InstrumentFile::AsyncWriter writer(Parallel::isMaster(comm) ? fileNameOut : FileName(), arcList); // write while computing
+    Parallel::forEachPrefetch(arcList, [&](UInt arcNo)
     {
       // read data
       std::vector<Arc> arc(file.size());
@@ -197,14 +201,15 @@ void InstrumentArcCalculate::run(Config &config, Parallel::CommunicatorPtr comm)
       }
 
       return Arc(timesOut, outData, type);
-    }, comm);
+    }, [&](UInt arcNo) {for(auto &f : file) f.prefetchArc(arcNo);},
+       [&](UInt arcNo) {writer.setReady(arcNo);}, comm);
 
     // write results
     // -------------
     if(!fileNameOut.empty() && Parallel::isMaster(comm))
     {
       logStatus<<"write instrument data <"<<fileNameOut<<">"<<Log::endl;
-      InstrumentFile::write(fileNameOut, arcList);
+      writer.finish();
       Arc::printStatistics(arcList);
     }
 
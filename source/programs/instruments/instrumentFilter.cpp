@@ -55,9 +55,11 @@ void InstrumentFilter::run(Config &config, Parallel::CommunicatorPtr comm)
 
     logStatus<<"read instrument data <"<<fileNameIn<<"> and filter"<<Log::endl;
     InstrumentFile instrumentFile(fileNameIn);
+    instrumentFile.setReadAhead(3);
 
     std::vector<Arc> arcList(instrumentFile.arcCount());
-    Parallel::forEach(arcList, [&](UInt arcNo)
+    InstrumentFile::AsyncWriter writer(Parallel::isMaster(comm) ? fileNameOut : FileName(), arcList); // write while filtering
+    Parallel::forEachPrefetch(arcList, [&](UInt arcNo)
     {
       Arc arc = instrumentFile.readArc(arcNo);
       if(arc.size() == 0)
@@ -66,12 +68,13 @@ void InstrumentFilter::run(Config &config, Parallel::CommunicatorPtr comm)
       countData = std::min(countData, data.columns()-1-startData);
       copy(filter->filter(data.column(1+startData, countData)), data.column(1+startData, countData));
       return Arc(arc.times(), data, arc.getType());
-    }, comm);
+    }, [&](UInt arcNo) {instrumentFile.prefetchArc(arcNo);},
+       [&](UInt arcNo) {writer.setReady(arcNo);}, comm);
 
     if(Parallel::isMaster(comm))
     {
       logStatus<<"write instrument data to file <"<<fileNameOut<<">"<<Log::endl;
-      InstrumentFile::write(fileNameOut, arcList);
+      writer.finish();
       Arc::printStatistics(arcList);
     }
   }
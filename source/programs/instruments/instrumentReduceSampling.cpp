@@ -55,21 +55,27 @@ void InstrumentReduceSampling::run(Config &config, Parallel::CommunicatorPtr /*c
     UInt arcCount = inFile.arcCount();
     std::list<Arc> arcList;
 
+    // integer nanoseconds avoid rounding issues of the modulo operation
+    const Int64 samplingNs = static_cast<Int64>(std::llround(1e9*seconds));
+    const Int64 marginNs   = static_cast<Int64>(std::llround(1e9*margin));
+    if(samplingNs <= 0)
+      throw(Exception("sampling must be positive"));
+
     Double refTime=0;
     Single::forEach(arcCount, [&](UInt arcNo)
     {
       std::vector<Time> times;
       Arc arc = inFile.readArc(arcNo);
-      if(arcNo==0 && relative2FirstEpoch)
+      if(arcNo==0 && relative2FirstEpoch && arc.size())
         refTime = arc.at(0).time.mjdMod();
       for(UInt i=0; i<arc.size(); i++)
       {
-
-        Double mod = std::fmod((arc.at(i).time.mjdMod()-refTime)*86400, seconds);
-
-        if(mod/seconds > 0.5)
-          mod -= seconds;
-        if(fabs(mod) <= margin)
+        Int64 mod = static_cast<Int64>(std::llround(1e9*86400*(arc.at(i).time.mjdMod()-refTime))) % samplingNs;
+        if(mod < 0)
+          mod += samplingNs;
+        if(2*mod > samplingNs)
+          mod -= samplingNs;
+        if(std::abs(mod) <= marginNs)
           if((times.size()==0) || (arc.at(i).time-times.back()).seconds()>(seconds-margin))
             times.push_back(arc.at(i).time);
       }
@@ -206,25 +206,37 @@ void InstrumentSynchronize::run(Config &config, Parallel::CommunicatorPtr /*comm
     // synchronize data
     // ----------------
     logStatus<<"synchronize data"<<Log::endl;
+    // times in integer nanoseconds relative to the first epoch
+    const Time  timeRef  = arc.at(0).size() ? arc.at(0).at(0).time : Time();
+    const Int64 marginNs = static_cast<Int64>(std::llround(1e9*margin));
+    std::vector<std::vector<Int64>> timesNs(arc.size());
+    for(UInt k=0; k<arc.size(); k++)
+    {
+      timesNs.at(k).resize(arc.at(k).size());
+      for(UInt i=0; i<arc.at(k).size(); i++)
+        timesNs.at(k).at(i) = static_cast<Int64>(std::llround(1e9*(arc.at(k).at(i).time-timeRef).seconds()));
+    }
+
     times.resize(arc.at(0).size());
     std::vector<UInt> index(arc.size(),0);
     for(UInt i=0; i<arc.at(0).size(); i++)
     {
-      Time time = arc.at(0).at(i).time;
+      const Int64 timeNs = timesNs.at(0).at(i);
 
       // this point of time in all files?
       Bool synchron = TRUE;
       Bool eof      = FALSE;
       for(UInt k=1; k<arc.size(); k++)
       {
-        while(((arc.at(k).at(index.at(k)).time-time).seconds() < -margin) && (++index.at(k)<arc.at(k).size()));
+        while((index.at(k)<timesNs.at(k).size()) && (timesNs.at(k).at(index.at(k))-timeNs < -marginNs))
+          index.at(k)++;
 
-        if(index.at(k)>=arc.at(k).size())
+        if(index.at(k)>=timesNs.at(k).size())
         {
           eof = TRUE;
           break;
         }
-        if(std::fabs((arc.at(k).at(index.at(k)).time-time).seconds()) > margin)
+        if(timesNs.at(k).at(index.at(k))-timeNs > marginNs)
         {
           synchron = FALSE;
           break;
@@ -232,7 +244,7 @@ void InstrumentSynchronize::run(Config &config, Parallel::CommunicatorPtr /*comm
       }
       if(eof)       break;
       if(!synchron) continue;
-      times.at(index.at(0)++) = time;
+      times.at(index.at(0)++) = arc.at(0).at(i).time;
     }
     times.resize(index.at(0));
 
@@ -31,6 +31,17 @@ In normal equation form this can be written as
 where $\mathbf{x}_t^- = \mathbf{B} \mathbf{x}^+_{t-1}$ and $\mathbf{P}_t^{-} = \mathbf{Q} + \mathbf{B} \mathbf{P}^+_{t-1}\mathbf{B}^T$
 are the predicted state and its covariance matrix.
 
+The filter is computed in square root form (see \program{KalmanSmoother}). With the cholesky decomposition
+$\mathbf{P}_t^{-} = \mathbf{W}^T\mathbf{W}$ of the predicted covariance and the (pivoted) cholesky decomposition
+$\mathbf{N}_t = \mathbf{C}^T\mathbf{C}$ of the normal equations the update is computed from the stacked factors
+$[\mathbf{I}; \mathbf{C}\mathbf{W}^T]$ as
+\begin{equation}
+\mathbf{I} + \mathbf{W}\mathbf{N}_t\mathbf{W}^T = \mathbf{R}^T\mathbf{R}, \hspace{25pt}
+\mathbf{P}^+_t = \mathbf{S}^T\mathbf{S} \text{ with } \mathbf{S} = \mathbf{R}^{-T}\mathbf{W},
+\end{equation}
+so no explicit inverse of the (possibly ill-conditioned) covariance matrices is needed.
+The normal equations of the next epoch are read in background while the current epoch is processed.
+
 The process dynamic $\mathbf{B}, \mathbf{Q}$ is represented as an \reference{autoregressive model}{fundamentals.autoregressiveModel},
 and passed to the program through \configFile{inputfileAutoregressiveModel}{matrix}.
 The sequence of normal equations $\mathbf{N}_t, \mathbf{n}_t$ are given as list of \configFile{inputfileNormalEquations}{normalEquation},
@@ -52,6 +63,7 @@ See also \program{KalmanBuildNormals}, \program{KalmanSmoother}.
 #include "files/fileNormalEquation.h"
 #include "classes/timeSeries/timeSeries.h"
 #include "misc/kalmanProcessing.h"
+#include <future>
 
 /***** CLASS ***********************************/
 
@@ -117,42 +129,48 @@ void KalmanFilter::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
       readFileMatrix(fileNameInitialState, updatedState);
     }
 
+    KalmanFilterSquareRoot filter(B, Q);
+    filter.init(updatedState, updatedStateCovariance);
+
+    // normal equations are read in background while the previous epoch is processed
+    auto readNormals = [&](UInt k)
+    {
+      return std::async(std::launch::async, [&fileNameNormals, k]()
+      {
+        NormalEquationInfo info;
+        Matrix N, n;
+        readFileNormalEquation(fileNameNormals.at(k), info, N, n);
+        return std::make_pair(N, n);
+      });
+    };
+
     // Run the filter:
     // ---------------
+    auto normalsNext = readNormals(0);
     for(UInt k = 0; k<fileNameNormals.size(); k++)
     {
-      Matrix predictedState = B*updatedState;
-      Matrix predictedStateCovariance = Q+B*updatedStateCovariance*B.trans();
+      auto normals = std::move(normalsNext);
+      if(k+1 < fileNameNormals.size())
+        normalsNext = readNormals(k+1);
 
       try
       {
-        NormalEquationInfo info;
         Matrix N, n;
-        readFileNormalEquation(fileNameNormals.at(k), info, N, n);
-
-        inverse(predictedStateCovariance);
-        updatedStateCovariance = predictedStateCovariance;
-        axpy(1.0, N, updatedStateCovariance.slice(0, 0, N.rows(), n.rows()));
-        inverse(updatedStateCovariance);
-        fillSymmetric(updatedStateCovariance);
-
-        matMult(-1.0, N, predictedState.row(0, N.rows()), n);
-        updatedState = predictedState;
-        matMult(1.0, updatedStateCovariance.column(0, n.rows()), n, updatedState);
+        std::tie(N, n) = normals.get();
+        filter.update(N, n);
       }
       catch(std::exception &e)
       {
         logWarning<<e.what()<<Log::endl;
-        updatedState = predictedState;
-        updatedStateCovariance = predictedStateCovariance;
+        filter.update(); // prediction only
       }
 
       logStatus <<"write updated state to <"<<fileNameState.at(k)<<">"<<Log::endl;
-      writeFileMatrix(fileNameState.at(k), updatedState);
+      writeFileMatrix(fileNameState.at(k), filter.state());
       if(!fileNameStateCovarianceMatrix.empty())
       {
         logStatus <<"write updated state covariance to <"<<fileNameStateCovarianceMatrix.at(k)<<">"<<Log::endl;
-        writeFileMatrix(fileNameStateCovarianceMatrix.at(k), updatedStateCovariance);
+        writeFileMatrix(fileNameStateCovarianceMatrix.at(k), filter.covariance());
       }
     }
   }
@@ -27,6 +27,9 @@ are the output of a \program{KalmanFilter} forward sweep.
 The matrix files for\configFile{outputfileUpdatedState}{matrix}, \configFile{inputfileUpdatedState}{matrix}
 and \configFile{inputfileUpdatedStateCovariance}{matrix} can also be specified using \configClass{loops}{loopType}.
 
+The smoother gain and the smoothed covariance matrices are computed from cholesky factors
+of the updated and predicted covariance matrices without explicit inverses.
+
 See also \program{KalmanBuildNormals}, \program{KalmanFilter} and \program{KalmanSmootherLeastSquares}.
 )";
 
@@ -37,6 +40,7 @@ See also \program{KalmanBuildNormals}, \program{KalmanFilter} and \program{Kalma
 #include "files/fileMatrix.h"
 #include "classes/timeSeries/timeSeries.h"
 #include "misc/kalmanProcessing.h"
+#include <future>
 
 /***** CLASS ***********************************/
 
@@ -92,7 +96,6 @@ void KalmanSmoother::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     // Initialize backward smoother:
     Matrix smoothedState, smoothedStateCovariance;
     Matrix updatedState, updatedStateCovariance;
-    Matrix predictedState, predictedStateCovariance;
 
     logStatus <<"initialize state with <"<<fileNameUpdatedState.back()<<"> and <"<<fileNameUpdatedCovariance.back()<<">"<<Log::endl;
     readFileMatrix(fileNameUpdatedState.back(), updatedState);
@@ -108,40 +111,28 @@ void KalmanSmoother::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
       writeFileMatrix(fileNameSmoothedCovariance.back(), smoothedStateCovariance);
     }
 
+    // updated states and covariances are read in background while the previous epoch is processed
+    auto readUpdated = [&](UInt k)
+    {
+      return std::async(std::launch::async, [&fileNameUpdatedState, &fileNameUpdatedCovariance, k]()
+      {
+        Matrix x, P;
+        readFileMatrix(fileNameUpdatedState.at(k), x);
+        readFileMatrix(fileNameUpdatedCovariance.at(k), P);
+        return std::make_pair(x, P);
+      });
+    };
+
+    std::future<std::pair<Matrix, Matrix>> updatedNext;
+    if(epochCount > 1)
+      updatedNext = readUpdated(epochCount-2);
     for(UInt k=epochCount-1; k>0; k--)
     {
-      readFileMatrix(fileNameUpdatedState.at(k-1), updatedState);
-      readFileMatrix(fileNameUpdatedCovariance.at(k-1), updatedStateCovariance);
-
-      predictedState = B*updatedState;
-
-      // predicted state covariance
-      cholesky(updatedStateCovariance);
-      Matrix smootherGain = B;
-      triangularMult(1.0, updatedStateCovariance, smootherGain.trans());
-
-      predictedStateCovariance = Q;
-      rankKUpdate(1.0, smootherGain.trans(), predictedStateCovariance);
-
-      // transposed gain matrix K
-      triangularMult(1.0, updatedStateCovariance.trans(), smootherGain.trans());
-      solveInPlace(predictedStateCovariance, smootherGain);
-
-      // smoothed state
-      smoothedState = updatedState + smootherGain.trans()*(smoothedState-predictedState);
-
-      // smoothed state covariance
-      zeroUnusedTriangle(predictedStateCovariance);
-      predictedStateCovariance.setType(Matrix::GENERAL);
-      rankKUpdate(-1.0, predictedStateCovariance, smoothedStateCovariance);
-      fillSymmetric(smoothedStateCovariance);
-      smoothedStateCovariance.setType(Matrix::GENERAL);
-
-      smoothedStateCovariance = smootherGain.trans()*smoothedStateCovariance*smootherGain;
-      smoothedStateCovariance.setType(Matrix::SYMMETRIC);
-      zeroUnusedTriangle(updatedStateCovariance);
-      updatedStateCovariance.setType(Matrix::GENERAL);
-      rankKUpdate(1.0, updatedStateCovariance, smoothedStateCovariance);
+      std::tie(updatedState, updatedStateCovariance) = updatedNext.get();
+      if(k > 1)
+        updatedNext = readUpdated(k-2);
+
+      KalmanFilterSquareRoot::smoothingStep(B, Q, updatedState, updatedStateCovariance, smoothedState, smoothedStateCovariance);
 
       logStatus <<"write smoothed state to <"<<fileNameSmoothedState.at(k-1)<<">"<<Log::endl;
       writeFileMatrix(fileNameSmoothedState.at(k-1), smoothedState);
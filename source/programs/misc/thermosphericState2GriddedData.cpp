@@ -67,15 +67,28 @@ void ThermosphericState2GriddedData::run(Config &config, Parallel::CommunicatorP
     Ellipsoid             ellipsoid(a, f);
     std::vector<Vector3d> points = grid->points();
     std::vector<Double>   areas  = grid->areas();
-    std::vector<Vector>   values(points.size());
-    Parallel::forEach(values, [&](UInt i)
+    const UInt blockSize = 1000;
+    std::vector<Matrix> values((points.size()+blockSize-1)/blockSize);
+    Parallel::forEach(values, [&](UInt idBlock)
     {
-      Double   density, temperature;
-      Vector3d wind;
-      thermosphere->state(time, points.at(i), density, temperature, wind);
-      if(useLocalFrame)
-        wind = localNorthEastUp(points.at(i), ellipsoid).inverseTransform(wind);
-      return Vector({density, temperature, wind.x(), wind.y(), wind.z()});
+      const UInt start = idBlock*blockSize;
+      const UInt count = std::min(blockSize, points.size()-start);
+      std::vector<Vector3d> pos(points.begin()+start, points.begin()+start+count);
+      std::vector<Double>   density, temperature;
+      std::vector<Vector3d> wind;
+      thermosphere->state(std::vector<Time>(count, time), pos, density, temperature, wind);
+      Matrix A(count, 5);
+      for(UInt i=0; i<count; i++)
+      {
+        if(useLocalFrame)
+          wind.at(i) = localNorthEastUp(pos.at(i), ellipsoid).inverseTransform(wind.at(i));
+        A(i, 0) = density.at(i);
+        A(i, 1) = temperature.at(i);
+        A(i, 2) = wind.at(i).x();
+        A(i, 3) = wind.at(i).y();
+        A(i, 4) = wind.at(i).z();
+      }
+      return A;
     }, comm);
 
     if(Parallel::isMaster(comm))
@@ -84,7 +97,7 @@ void ThermosphericState2GriddedData::run(Config &config, Parallel::CommunicatorP
       std::vector<std::vector<Double>> field(5, std::vector<Double>(points.size()));
       for(UInt i=0; i<points.size(); i++)
         for(UInt k=0; k<field.size(); k++)
-          field.at(k).at(i) = values.at(i).at(k);
+          field.at(k).at(i) = values.at(i/blockSize)(i%blockSize, k);
 
       logStatus<<"save values to file <"<<fileNameGrid<<">"<<Log::endl;
       GriddedData griddedData(ellipsoid, points, areas, field);
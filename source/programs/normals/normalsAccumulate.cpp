@@ -16,6 +16,21 @@ This program accumulates normal equations and writes the total combined system t
 \configFile{outputfileNormalequation}{normalEquation}.
 The \configFile{inputfileNormalEquation}{normalEquation}s must have all the same size and the same block structure.
 This program is the simplified and fast version of the more general program \program{NormalsBuild}.
+
+The normal equations given in \configFile{inputfileNormalEquationSubtract}{normalEquation} are subtracted.
+This enables rolling window solutions: the accumulated normals of the previous window are updated
+by adding the newest interval and subtracting the oldest one, instead of accumulating the full window again.
+
+To detect inconsistent windows the time intervals contained in the normals are stored in the output file.
+The interval of the added normals is given by \config{timeStart} and \config{timeEnd},
+the interval of the subtracted normals by \config{timeStartSubtract} and \config{timeEndSubtract}.
+Intervals already stored in the input files are taken over.
+Adding an interval which overlaps the accumulated ones, subtracting an interval which was never added
+or which was already subtracted throws an exception. Normals without stored intervals are not checked.
+
+Each update adds and subtracts large numbers, so round-off errors accumulate in the normal matrix
+and in $\M l^T\M P\M l$ with the number of updates. For long series the window should be
+accumulated anew from the original normals from time to time (e.g. once per year).
 )";
 
 /***********************************************/
@@ -24,6 +39,43 @@ This program is the simplified and fast version of the more general program \pro
 #include "files/fileMatrix.h"
 #include "files/fileNormalEquation.h"
 
+/***********************************************/
+
+// intervals are sorted, disjoint, and adjacent intervals are merged
+static void addInterval(std::vector<std::pair<Time, Time>> &intervals, const Time &timeStart, const Time &timeEnd)
+{
+  if(timeEnd <= timeStart)
+    throw(Exception("empty interval ["+timeStart.dateTimeStr()+", "+timeEnd.dateTimeStr()+")"));
+  for(const auto &interval : intervals)
+    if((timeStart < interval.second) && (interval.first < timeEnd))
+      throw(Exception("interval ["+timeStart.dateTimeStr()+", "+timeEnd.dateTimeStr()+") is already contained in the accumulated normals"));
+  intervals.push_back({timeStart, timeEnd});
+  std::sort(intervals.begin(), intervals.end());
+  for(UInt i=intervals.size()-1; i-->0;)
+    if(intervals.at(i).second == intervals.at(i+1).first)
+    {
+      intervals.at(i).second = intervals.at(i+1).second;
+      intervals.erase(intervals.begin()+i+1);
+    }
+}
+
+/***********************************************/
+
+static void subtractInterval(std::vector<std::pair<Time, Time>> &intervals, const Time &timeStart, const Time &timeEnd)
+{
+  auto iter = std::find_if(intervals.begin(), intervals.end(), [&](const auto &interval) {return (interval.first <= timeStart) && (timeEnd <= interval.second);});
+  if(iter == intervals.end())
+    throw(Exception("interval ["+timeStart.dateTimeStr()+", "+timeEnd.dateTimeStr()+") is not contained in the accumulated normals (never added or already subtracted)"));
+  const std::pair<Time, Time> rest(timeEnd, iter->second);
+  iter->second = timeStart;
+  if(iter->first == iter->second)
+    iter = intervals.erase(iter);
+  else
+    iter++;
+  if(rest.first < rest.second)
+    intervals.insert(iter, rest);
+}
+
 /***** CLASS ***********************************/
 
 /** @brief Accumulate normal equations and write it to file.
@@ -43,13 +95,19 @@ void NormalsAccumulate::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
   try
   {
     FileName fileNameOut;
-    std::vector<FileName> fileNameInAll;
+    std::vector<FileName> fileNameInAll, fileNameSubtract;
+    Time     timeStart, timeEnd, timeStartSubtract, timeEndSubtract;
 
     renameDeprecatedConfig(config, "outputfileNormalequation", "outputfileNormalEquation", date2time(2020, 6, 3));
     renameDeprecatedConfig(config, "inputfileNormalequation",  "inputfileNormalEquation",  date2time(2020, 6, 3));
 
     readConfig(config, "outputfileNormalEquation", fileNameOut,   Config::MUSTSET,  "", "");
     readConfig(config, "inputfileNormalEquation",  fileNameInAll, Config::MUSTSET,  "", "");
+    readConfig(config, "inputfileNormalEquationSubtract", fileNameSubtract, Config::OPTIONAL, "", "e.g. oldest interval of a rolling window");
+    readConfig(config, "timeStart",                timeStart,         Config::OPTIONAL, "", "interval of the added normals (stored in output for consistency checks)");
+    readConfig(config, "timeEnd",                  timeEnd,           Config::OPTIONAL, "", "interval of the added normals (exclusive)");
+    readConfig(config, "timeStartSubtract",        timeStartSubtract, Config::OPTIONAL, "", "interval of the subtracted normals");
+    readConfig(config, "timeEndSubtract",          timeEndSubtract,   Config::OPTIONAL, "", "interval of the subtracted normals (exclusive)");
     if(isCreateSchema(config)) return;
 
     // ==================================
@@ -58,23 +116,43 @@ void NormalsAccumulate::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     Matrix nOut;
     NormalEquationInfo infoOut;
     std::vector<FileName> fileNameIn;
+    std::vector<Double>   factorIn;
     std::vector<Matrix>   usedBlocksIn;
-    for(UInt i=0; i<fileNameInAll.size(); i++)
+    std::vector<std::pair<Time, Time>> intervals, intervalsSubtract;
+    UInt countWithoutInterval = 0; // added normals
+    for(UInt i=0; i<fileNameInAll.size()+fileNameSubtract.size(); i++)
     {
+      const Bool     isSubtract = (i >= fileNameInAll.size());
+      const FileName fileName   = isSubtract ? fileNameSubtract.at(i-fileNameInAll.size()) : fileNameInAll.at(i);
       Matrix nIn;
       NormalEquationInfo infoIn;
       try
       {
-        readFileNormalEquation(fileNameInAll.at(i), infoIn, nIn);
+        readFileNormalEquation(fileName, infoIn, nIn);
       }
       catch(std::exception &e)
       {
+        if(isSubtract) // missing normals would give a wrong window
+          throw;
         logWarning<<e.what()<<" continue..."<<Log::endl;
         continue;
       }
 
-      fileNameIn.push_back(fileNameInAll.at(i));
+      if(isSubtract && !infoOut.blockIndex.size())
+        throw(Exception("no normal equations to subtract <"+fileName.str()+"> from"));
+
+      fileNameIn.push_back(fileName);
+      factorIn.push_back(isSubtract ? -1. : 1.);
       usedBlocksIn.push_back(infoIn.usedBlocks);
+      if(!isSubtract && !infoIn.intervalStart.size())
+        countWithoutInterval++;
+      for(UInt k=0; k<infoIn.intervalStart.size(); k++)
+      {
+        if(isSubtract)
+          intervalsSubtract.push_back({infoIn.intervalStart.at(k), infoIn.intervalEnd.at(k)});
+        else
+          addInterval(intervals, infoIn.intervalStart.at(k), infoIn.intervalEnd.at(k));
+      }
       if(!infoOut.blockIndex.size())
       {
         infoOut = infoIn;
@@ -95,11 +173,46 @@ void NormalsAccumulate::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
         if(!infoOut.parameterName.at(i).combine(infoIn.parameterName.at(i)))
           logWarning << "Parameter names do not match at index " << i << ": '" << infoOut.parameterName.at(i).str() << "' != '" << infoIn.parameterName.at(i).str() << "'" << Log::endl;
 
+      if(isSubtract)
+      {
+        if(infoIn.observationCount > infoOut.observationCount)
+          throw(Exception("<"+fileName.str()+"> contains more observations than the accumulated normals"));
+        nOut -= nIn;
+        infoOut.lPl              -= infoIn.lPl;
+        infoOut.observationCount -= infoIn.observationCount;
+        continue;
+      }
+
       nOut += nIn;
       infoOut.lPl              += infoIn.lPl;
       infoOut.observationCount += infoIn.observationCount;
     }
 
+    // window metadata
+    // ---------------
+    if((timeStart != Time()) || (timeEnd != Time()))
+      addInterval(intervals, timeStart, timeEnd);
+    else if(countWithoutInterval && intervals.size())
+      throw(Exception("accumulated normals contain time intervals, the interval of the added normals must be given"));
+    if((timeStartSubtract != Time()) || (timeEndSubtract != Time()))
+      intervalsSubtract.push_back({timeStartSubtract, timeEndSubtract});
+    if(fileNameSubtract.size() && intervals.size() && !intervalsSubtract.size())
+      throw(Exception("accumulated normals contain time intervals, the interval of the subtracted normals must be given"));
+    if(fileNameSubtract.size() && !intervals.size())
+      logWarning<<"normals without time intervals, subtraction cannot be checked"<<Log::endl;
+    else
+      for(const auto &interval : intervalsSubtract)
+        subtractInterval(intervals, interval.first, interval.second);
+    infoOut.intervalStart.clear();
+    infoOut.intervalEnd.clear();
+    for(const auto &interval : intervals)
+    {
+      infoOut.intervalStart.push_back(interval.first);
+      infoOut.intervalEnd.push_back(interval.second);
+    }
+    for(UInt i=0; i<intervals.size(); i++)
+      logInfo<<"  contains ["<<intervals.at(i).first.dateTimeStr()<<", "<<intervals.at(i).second.dateTimeStr()<<")"<<Log::endl;
+
     // ==================================
 
     logStatus<<"read and write block normals"<<Log::endl;
@@ -125,9 +238,9 @@ void NormalsAccumulate::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
             Matrix N2;
             readFileMatrix(fileNameIn.at(i).appendBaseName(ext), N2);
             if(N.size())
-              N += N2;
+              axpy(factorIn.at(i), N2, N);
             else
-              N = N2;
+              N = factorIn.at(i) * N2;
           }
 
         logStatus<<"write matrix <"<<fileNameOut.appendBaseName(ext)<<">"<<Log::endl;
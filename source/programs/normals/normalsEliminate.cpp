@@ -45,6 +45,10 @@ and $\hat{\M x}_2$ shall be eliminated, the reduced system of normal equations i
 \qquad\text{and}\qquad\bar{\M n} =  \M n_1 - \M N_{12}\M N_{22}^{-1}\M n_2.
 \end{equation}
 
+The blocks of the input normal matrix are split at the boundaries between eliminated and remaining parameters
+and the elimination is applied directly to these blocks. This avoids a redistribution of the full matrix,
+only the reduced normal matrix is reordered afterwards.
+
 See also \program{NormalsReorder}.
 )";
 
@@ -118,34 +122,77 @@ void NormalsEliminate::run(Config &config, Parallel::CommunicatorPtr comm)
     for(UInt i=0; i<parameterCountNew; i++)
       info.parameterName.at(i) = (indexVector.at(i) != NULLINDEX) ? parameterNamesOld.at(indexVector.at(i)) : ParameterName();
 
-    // prepend to-be-eliminated parameters to (remaining) index vector and block structure
-    if(eliminationCount > 0)
-    {
-      for(auto &&index : blockIndex)
-        index += eliminationCount;
-      eliminationBlockIndex.pop_back();
-      blockIndex.insert(blockIndex.begin(), eliminationBlockIndex.begin(), eliminationBlockIndex.end());
-      indexVector.insert(indexVector.begin(), eliminationIndexVector.begin(), eliminationIndexVector.end());
-    }
-
-    logStatus<<"reorder normal matrix"<<Log::endl;
-    normal.reorder(indexVector, blockIndex);
-    rhs = reorder(rhs, indexVector);
-
-    if(eliminationCount > 0)
+    // Schur complement of the leading blocks
+    auto eliminate = [&](UInt blocks)
     {
       logStatus<<"eliminate parameters from normal equations"<<Log::endl;
-      const UInt eliminationBlocks = eliminationBlockIndex.size();
-      normal.cholesky(TRUE, 0, eliminationBlocks, TRUE);
-      normal.triangularTransSolve(rhs, 0, eliminationBlocks);
-      normal.eraseBlocks(0, eliminationBlocks);
+      normal.cholesky(TRUE, 0, blocks, TRUE);
+      normal.triangularTransSolve(rhs, 0, blocks);
+      normal.eraseBlocks(0, blocks);
       info.observationCount -= eliminationCount;
       for(UInt i=0; i<info.lPl.rows(); i++)
         info.lPl(i) -= quadsum(rhs.slice(0, i, eliminationCount, 1)); // lPl = lPl - n1' N1^(-1) n1
       rhs = rhs.row(eliminationCount, rhs.rows()-eliminationCount);
+    };
+
+    // split the blocks at the boundaries between eliminated and remaining parameters
+    // -> eliminated blocks first, the blocks are sliced in place without redistribution
+    std::vector<UInt> remainingIndexVector = ParameterSelector::indexVectorComplement(eliminationIndexVector, parameterCountOld);
+    std::vector<UInt> partitionIndexVector = eliminationIndexVector;
+    partitionIndexVector.insert(partitionIndexVector.end(), remainingIndexVector.begin(), remainingIndexVector.end());
+    std::vector<UInt> partitionBlockIndex(1, 0);
+    UInt eliminationBlocks = 0;
+    for(UInt i=1; i<=partitionIndexVector.size(); i++)
+      if((i == partitionIndexVector.size()) || (i == eliminationCount) || (partitionIndexVector.at(i) != partitionIndexVector.at(i-1)+1) ||
+         (normal.index2block(partitionIndexVector.at(i)) != normal.index2block(partitionIndexVector.at(i-1))))
+      {
+        partitionBlockIndex.push_back(i);
+        if(i <= eliminationCount)
+          eliminationBlocks++;
+      }
+
+    if((eliminationCount > 0) && (partitionBlockIndex.size()-1 <= 4*normal.blockCount()))
+    {
+      logStatus<<"partition normal matrix ("<<partitionBlockIndex.size()-1<<" blocks)"<<Log::endl;
+      if(!normal.reorderInPlace(partitionIndexVector, partitionBlockIndex)) // blocks are redistributed by the final reorder
+        normal.reorder(partitionIndexVector, partitionBlockIndex);
+      rhs = reorder(rhs, partitionIndexVector);
+
+      eliminate(eliminationBlocks);
+
+      // index of remaining parameters within the reduced system
+      std::vector<UInt> position(parameterCountOld, NULLINDEX);
+      for(UInt i=0; i<remainingIndexVector.size(); i++)
+        position.at(remainingIndexVector.at(i)) = i;
+      for(auto &index : indexVector)
+        if(index != NULLINDEX)
+          index = position.at(index);
+
+      logStatus<<"reorder normal matrix"<<Log::endl;
+      normal.reorder(indexVector, blockIndex);
+      rhs = reorder(rhs, indexVector);
     }
     else
-      logWarningOnce<<"no parameters eliminated"<<Log::endl;
+    {
+      // strongly fragmented blocks: prepend to-be-eliminated parameters to (remaining) index vector and block structure
+      if(eliminationCount > 0)
+      {
+        for(auto &&index : blockIndex)
+          index += eliminationCount;
+        eliminationBlockIndex.pop_back();
+        blockIndex.insert(blockIndex.begin(), eliminationBlockIndex.begin(), eliminationBlockIndex.end());
+        indexVector.insert(indexVector.begin(), eliminationIndexVector.begin(), eliminationIndexVector.end());
+      }
+
+      logStatus<<"reorder normal matrix"<<Log::endl;
+      normal.reorder(indexVector, blockIndex);
+      rhs = reorder(rhs, indexVector);
+
+      if(eliminationCount > 0)
+        eliminate(eliminationBlockIndex.size());
+      else
+        logWarningOnce<<"no parameters eliminated"<<Log::endl;
+    }
 
     logStatus<<"write normal equations to <"<<outName<<">"<<Log::endl;
     writeFileNormalEquation(outName, info, normal, rhs);
@@ -31,6 +31,23 @@ parameter and columns for each \configClass{normalEquation}{normalEquationType}
 and indicates the contribution of the individual normals to the estimated parameters.
 Each row sum up to one.
 
+The Cholesky decomposition of the combined normal matrix is the most expensive part of each iteration.
+If all variance factors changed relatively by less than \config{reuseCholeskyMaxChange}
+since the last decomposition, the decomposition is reused as preconditioner and the normals are solved
+by conjugate gradients, which only needs matrix vector products. The redundancies of the next iteration
+are computed with the Monte-Carlo-vectors of the last decomposition in this case.
+If the variance factors converge with these outdated Monte-Carlo-vectors,
+one more iteration with a new decomposition is done to avoid biased variance factors.
+As the variance factors converge, the relative changes become small and only a few decompositions are needed.
+This requires memory for a second copy of the normal matrix.
+
+The redundancies needed for the variance factors are traces estimated with random Monte-Carlo-vectors.
+If \config{monteCarloAccuracy} is set, the number of these vectors is adapted with each new decomposition
+so that the relative standard deviation of the estimated redundancies reaches this value
+(at most \config{monteCarloMaxSampleCount} vectors). The variance factors are only accepted as converged
+if this accuracy is reached. The vectors are generated at the processes holding the diagonal blocks
+of the distributed normal matrix and solved with the distributed decomposition.
+
 See also \program{NormalsBuild}.
 )";
 
@@ -67,6 +84,9 @@ void NormalsSolverVCE::run(Config &config, Parallel::CommunicatorPtr comm)
     UInt              rhsNo;
     UInt              maxIter;
     UInt              blockSize;
+    Double            maxFactorChange;
+    Double            monteCarloAccuracy;
+    UInt              monteCarloMaxCount;
 
     renameDeprecatedConfig(config, "outputfileNormalequation", "outputfileNormalEquation", date2time(2020, 6, 3));
     renameDeprecatedConfig(config, "normalequation",           "normalEquation",           date2time(2020, 6, 3));
@@ -82,10 +102,14 @@ void NormalsSolverVCE::run(Config &config, Parallel::CommunicatorPtr comm)
     readConfig(config, "rightHandSideNumberVCE",    rhsNo,                   Config::DEFAULT,  "0",    "the right hand side number for estimation of variance factors");
     readConfig(config, "normalsBlockSize",          blockSize,               Config::DEFAULT,  "2048", "block size for distributing the normal equations, 0: one block");
     readConfig(config, "maxIterationCount",         maxIter,                 Config::DEFAULT,  "20",   "maximum number of iterations for variance component estimation");
+    readConfig(config, "reuseCholeskyMaxChange",    maxFactorChange,         Config::DEFAULT,  "0",    "reuse cholesky decomposition if all variance factors changed relatively less (0: new decomposition in each iteration)");
+    readConfig(config, "monteCarloAccuracy",        monteCarloAccuracy,      Config::DEFAULT,  "0",    "target relative standard deviation of the estimated redundancies (0: fixed 100 Monte-Carlo samples)");
+    readConfig(config, "monteCarloMaxSampleCount",  monteCarloMaxCount,      Config::DEFAULT,  "1000", "maximum number of Monte-Carlo samples for the redundancies");
     if(isCreateSchema(config)) return;
 
     logStatus<<"init normal equations"<<Log::endl;
     normals->init(blockSize, comm);
+    normals->setMonteCarloAccuracy(monteCarloAccuracy, monteCarloMaxCount);
     logInfo<<"  number of unknown parameters: "<<normals->parameterCount()<<Log::endl;
     logInfo<<"  number of right hand sides:   "<<normals->rightHandSideCount()<<Log::endl;
 
@@ -142,7 +166,7 @@ void NormalsSolverVCE::run(Config &config, Parallel::CommunicatorPtr comm)
       }
 
       logStatus<<"solve normal equations"<<Log::endl;
-      Matrix x = normals->solve();
+      Matrix x = normals->solve(maxFactorChange);
       logInfo<<"  sigma (total) = "<<normals->aposterioriSigma()<<Log::endl;
 
       if(Parallel::isMaster(comm) && !fileNameSolution.empty())
@@ -132,6 +132,8 @@ void PlotGraph::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     // create data files
     // -----------------
     logStatus<<"create temporary data files"<<Log::endl;
+    for(UInt i=0; i<layer.size(); i++)
+      layer.at(i)->setResolution(axisX->getMin(), axisX->getMax(), axisX->isLogarithmic(), static_cast<UInt>(plotBasics.width*plotBasics.dpi/2.54));
     for(UInt i=0; i<layer.size(); i++)
       if(axisY2 && layer.at(i)->drawOnSecondAxis())
         layer.at(i)->writeDataFile(plotBasics.workingDirectory, i, minX, maxX, minY2, maxY2);
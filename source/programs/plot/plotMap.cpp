@@ -144,6 +144,15 @@ void PlotMap::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     // create data files
     // -----------------
     logStatus<<"create temporary data files"<<Log::endl;
+    {
+      // conservative estimate of the angular pixel size
+      Double rangeL = std::remainder(maxL-minL, 2*PI);
+      if(rangeL <= 0)
+        rangeL += 2*PI;
+      const Double pixelCount = std::max(plotBasics.width, plotBasics.height)*plotBasics.dpi/2.54;
+      for(UInt i=0; i<layer.size(); i++)
+        layer.at(i)->setResolution(Angle(std::min(rangeL, Double(maxB-minB))/pixelCount));
+    }
     for(UInt i=0; i<layer.size(); i++)
       layer.at(i)->writeDataFile(ellipsoid, plotBasics.workingDirectory, i);
 
@@ -0,0 +1,138 @@
+/***********************************************/
+/**
+* @file concurrentPrograms.cpp
+*
+* @brief Runs independent programs concurrently.
+*
+* @author agent
+* @date 2026-10-18
+*/
+/***********************************************/
+
+// Latex documentation
+#define DOCSTRING docstring
+static const char *docstring = R"(
+Runs a list of \config{program}s with the same results as \program{GroupPrograms},
+but independent programs are executed concurrently on different processes.
+
+The dependencies are derived from the names of all \verb|inputfile*| and \verb|outputfile*|
+config elements. A program must wait for a previous program if both access the same file (or directory)
+and at least one of them writes it. File names with variables not known in advance
+(e.g. variables defined within the program) are treated as all files starting with the resolved part.
+System programs (e.g. nested program lists or file operations)
+are executed alone with all processes.
+
+The programs are sorted into consecutive steps. All programs of a step are independent from each other
+and only depend on programs of previous steps. The processes are divided into groups
+and each group runs a part of the programs of a step. Processes not needed for single process programs
+are assigned to groups with parallel programs.
+The output of the programs is written only by the main process of each group
+unless \config{parallelLog}=\verb|yes|.
+
+Loops and conditions at program level (attributes of \config{program}) might depend on the results of
+previous programs. In this case, or if only a single process is available, the programs are executed sequentially.
+)";
+
+/***********************************************/
+
+#include "programs/program.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Runs independent programs concurrently.
+* @ingroup programsGroup */
+class ConcurrentPrograms
+{
+public:
+  void run(Config &config, Parallel::CommunicatorPtr comm);
+};
+
+GROOPS_REGISTER_PROGRAM(ConcurrentPrograms, PARALLEL, "Runs independent programs concurrently.", System)
+
+/***********************************************/
+
+void ConcurrentPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    Bool          parallelLog;
+    ProgramConfig programs;
+
+    readConfig(config, "parallelLog", parallelLog, Config::DEFAULT,  "0", "write to screen/log file from all processes");
+    readConfig(config, "program",     programs,    Config::OPTIONAL, "",  "");
+    if(isCreateSchema(config)) return;
+
+    VariableList varList;
+    std::vector<ProgramConfig::Step> steps;
+    if((Parallel::size(comm) < 2) || !programs.steps(varList, steps))
+    {
+      logInfo<<"  programs are executed sequentially"<<Log::endl;
+      programs.run(varList, comm);
+      return;
+    }
+
+    // dependencies -> earliest possible step
+    // --------------------------------------
+    std::vector<UInt> level(steps.size(), 0);
+    for(UInt i=0; i<steps.size(); i++)
+      for(UInt k=0; k<i; k++)
+        if(steps.at(i).dependsOn(steps.at(k)))
+          level.at(i) = std::max(level.at(i), level.at(k)+1);
+    const UInt levelCount = (steps.size()) ? *std::max_element(level.begin(), level.end())+1 : 0;
+    logInfo<<"  "<<steps.size()<<" programs in "<<levelCount<<" steps"<<Log::endl;
+
+    for(UInt idLevel=0; idLevel<levelCount; idLevel++)
+    {
+      std::vector<UInt> index;
+      for(UInt i=0; i<steps.size(); i++)
+        if(level.at(i) == idLevel)
+          index.push_back(i);
+
+      Parallel::barrier(comm);
+      if(index.size() == 1)
+      {
+        ProgramConfig::run(steps.at(index.front()), comm);
+        continue;
+      }
+
+      // first processes are the main processes of the groups,
+      // remaining processes are distributed to groups with parallel programs
+      const UInt groupCount = std::min(index.size(), Parallel::size(comm));
+      std::vector<UInt> parallelGroups;
+      for(UInt idGroup=0; idGroup<groupCount; idGroup++)
+        for(UInt i=idGroup; i<index.size(); i+=groupCount)
+          if(!steps.at(index.at(i)).program->isSingleProcess())
+          {
+            parallelGroups.push_back(idGroup);
+            break;
+          }
+
+      const UInt rank = Parallel::myRank(comm);
+      UInt idGroup = NULLINDEX;
+      if(rank < groupCount)
+        idGroup = rank;
+      else if(parallelGroups.size())
+        idGroup = parallelGroups.at((rank-groupCount) % parallelGroups.size());
+      logStatus<<"=== "<<idLevel+1<<". step: "<<index.size()<<" programs in "<<groupCount<<" groups ==="<<Log::endl;
+
+      auto commGroup = Parallel::splitCommunicator(idGroup, rank, comm);
+      if(commGroup)
+      {
+        const Bool isMainProcess = Parallel::isMaster(commGroup);
+        Log::GroupPtr groupPtr = Log::group(isMainProcess || parallelLog, !isMainProcess && !parallelLog); // group is freed in the destructor
+        Parallel::broadCastExceptions(commGroup, [&](Parallel::CommunicatorPtr commGroup)
+        {
+          for(UInt i=idGroup; i<index.size(); i+=groupCount)
+            ProgramConfig::run(steps.at(index.at(i)), commGroup);
+        });
+      }
+    }
+    Parallel::barrier(comm);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
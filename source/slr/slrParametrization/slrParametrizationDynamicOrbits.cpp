@@ -121,8 +121,8 @@ void SlrParametrizationDynamicOrbits::init(Slr *slr, const std::vector<const Slr
         // timer.loopEnd();
 
         // set satellites position and velocity to arc values
-        reshape(para->polynomial.interpolate(para->sat->times, para->pos, 3), para->sat->pos.trans());
-        reshape(para->polynomial.interpolate(para->sat->times, para->vel, 3), para->sat->vel.trans());
+        para->sat->updateOrbit(reshape(para->polynomial.interpolate(para->sat->times, para->pos, 3), 3, para->sat->times.size()).trans(),
+                               reshape(para->polynomial.interpolate(para->sat->times, para->vel, 3), 3, para->sat->times.size()).trans());
       } // for(idSat)
   }
   catch(std::exception &e)
@@ -250,8 +250,8 @@ Double SlrParametrizationDynamicOrbits::updateParameter(const SlrNormalEquationI
         auto sat = para->sat;
         Matrix posOld = sat->pos;
 
-        reshape(para->polynomial.interpolate(sat->times, para->pos, 3), sat->pos.trans());
-        reshape(para->polynomial.interpolate(sat->times, para->vel, 3), sat->vel.trans());
+        sat->updateOrbit(reshape(para->polynomial.interpolate(sat->times, para->pos, 3), 3, sat->times.size()).trans(),
+                         reshape(para->polynomial.interpolate(sat->times, para->vel, 3), 3, sat->times.size()).trans());
 
         for(UInt idEpoch=0; idEpoch<sat->times.size(); idEpoch++)
         {
@@ -31,14 +31,16 @@ typedef std::shared_ptr<SlrSatellite> SlrSatellitePtr;
 class SlrSatellite : public SlrPlatform
 {
 public:
-  Polynomial        polynomial;
-  std::vector<Time> times;
-  Matrix            pos, vel; // CoM in CRF (epoch x (x,y,z))
-  Matrix            srf2crf;
+  Polynomial            polynomial;
+  PolynomialPiecewise3d polynomialPos, polynomialVel;
+  std::vector<Time>     times;
+  Matrix                pos, vel; // CoM in CRF (epoch x (x,y,z)), modify only with updateOrbit()
+  Matrix                srf2crf;
 
   SlrSatellite(const Platform &platform, const std::vector<Time> &times,
                const_MatrixSliceRef position, const_MatrixSliceRef velocity, const_MatrixSliceRef srf2crf, UInt interpolationDegree)
-    : SlrPlatform(platform), polynomial(times, interpolationDegree, FALSE/*throwException*/), times(times), pos(position), vel(velocity), srf2crf(srf2crf) {}
+    : SlrPlatform(platform), polynomial(times, interpolationDegree, FALSE/*throwException*/),
+      polynomialPos(polynomial, position), polynomialVel(polynomial, velocity), times(times), pos(position), vel(velocity), srf2crf(srf2crf) {}
 
   /// Destructor.
   virtual ~SlrSatellite() {}
@@ -52,6 +54,11 @@ public:
   /** @brief velocity in CRF [m/s]. */
   Vector3d velocity(const Time &time) const;
 
+  /** @brief Set new orbit at @a times.
+  * @param position (epochs x (x,y,z))
+  * @param velocity (epochs x (x,y,z)) */
+  void updateOrbit(const_MatrixSliceRef position, const_MatrixSliceRef velocity);
+
   /** @brief Vector from center of mass to the reflector in CRF [m].
   * With corrections (e.g. range bias).
   * @param time of reflection
@@ -65,7 +72,7 @@ inline Vector3d SlrSatellite::position(const Time &time) const
 {
   try
   {
-    return Vector3d(polynomial.interpolate({time}, pos));
+    return polynomialPos.interpolate(time);
   }
   catch(std::exception &e)
   {
@@ -79,7 +86,24 @@ inline Vector3d SlrSatellite::velocity(const Time &time) const
 {
   try
   {
-    return Vector3d(polynomial.interpolate({time}, vel));
+    return polynomialVel.interpolate(time);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline void SlrSatellite::updateOrbit(const_MatrixSliceRef position, const_MatrixSliceRef velocity)
+{
+  try
+  {
+    pos = position;
+    vel = velocity;
+    polynomialPos.init(polynomial, pos);
+    polynomialVel.init(polynomial, vel);
   }
   catch(std::exception &e)
   {